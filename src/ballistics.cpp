@@ -417,3 +417,95 @@ dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tri
 
     return attack;
 }
+
+ray_batch::ray_batch( const tripoint &origin, const int range ) : origin( origin ),
+    range( std::max( range, 0 ) )
+{
+    read_tiles();
+}
+
+void ray_batch::read_tiles()
+{
+    const int side = 2 * range + 1;
+    tiles.assign( side * side, 0 );
+    for( int y = origin.y - range; y <= origin.y + range; y++ ) {
+        for( int x = origin.x - range; x <= origin.x + range; x++ ) {
+            const tripoint p( x, y, origin.z );
+            if( g->m.impassable( p ) ) {
+                tiles[index( p )] = BLOCKED;
+            }
+        }
+    }
+    // Faster than looking for a creature on each tile
+    for( const Creature &critter : g->all_creatures() ) {
+        if( inside( critter.pos() ) ) {
+            tiles[index( critter.pos() )] |= OCCUPIED;
+        }
+    }
+}
+
+void ray_batch::add_ray( const tripoint &target )
+{
+    targets.push_back( target );
+}
+
+void ray_batch::trace()
+{
+    paths.clear();
+    path_starts.assign( 1, 0 );
+    first_hits.clear();
+    for( const tripoint &target : targets ) {
+        const std::vector<tripoint> path = line_to( origin, target );
+        paths.insert( paths.end(), path.begin(), path.end() );
+        path_starts.push_back( paths.size() );
+    }
+    first_hits.resize( targets.size() );
+    for( size_t ray = 0; ray < targets.size(); ray++ ) {
+        size_t step = 0;
+        while( step < length( ray ) && !stops( point_at( ray, step ) ) ) {
+            step++;
+        }
+        first_hits[ray] = step;
+    }
+    new_stops = false;
+}
+
+size_t ray_batch::next_hit( const size_t ray, size_t step ) const
+{
+    if( step == 0 && !new_stops ) {
+        // Tiles only stopped being in the way since the rays were traced
+        step = first_hits[ray];
+    }
+    while( step < length( ray ) && !stops( point_at( ray, step ) ) ) {
+        step++;
+    }
+    return step;
+}
+
+void ray_batch::refresh( const tripoint &p )
+{
+    if( !inside( p ) ) {
+        return;
+    }
+    uint8_t &flags = tiles[index( p )];
+    uint8_t new_flags = 0;
+    if( g->m.impassable( p ) ) {
+        new_flags |= BLOCKED;
+    }
+    if( g->critter_at( p, true ) != nullptr ) {
+        new_flags |= OCCUPIED;
+    }
+    if( flags == 0 && new_flags != 0 ) {
+        new_stops = true;
+    }
+    flags = new_flags;
+}
+
+void ray_batch::rebuild()
+{
+    const std::vector<uint8_t> old_tiles = tiles;
+    read_tiles();
+    for( size_t i = 0; i < tiles.size() && !new_stops; i++ ) {
+        new_stops = old_tiles[i] == 0 && tiles[i] != 0;
+    }
+}
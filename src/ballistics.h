@@ -2,12 +2,17 @@
 #ifndef BALLISTICS_H
 #define BALLISTICS_H
 
+#include "enums.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
 class Creature;
 class dispersion_sources;
 class vehicle;
 struct dealt_projectile_attack;
 struct projectile;
-struct tripoint;
 
 /** Aim result for a single projectile attack */
 struct projectile_attack_aim {
@@ -31,4 +36,78 @@ dealt_projectile_attack projectile_attack( const projectile &proj, const tripoin
         const tripoint &target, dispersion_sources dispersion,
         Creature *origin = nullptr, const vehicle *in_veh = nullptr );
 
+/**
+ * Traces many straight rays from one point at once, for attacks that send out lots of
+ * projectiles (like shrapnel). Which tiles around the origin could stop a ray (obstacles
+ * and creatures) is read from the map once, into a flat grid, and all rays are walked
+ * over that grid in one pass to find the first such tile on each of them.
+ *
+ * What happens at those tiles is up to the caller. If it changes a tile (bashes it or
+ * hurts a creature there), it has to call @ref refresh so the later rays see the change.
+ * If the change may have reached other tiles (a creature died, something was destroyed,
+ * which can make things explode, collapse or spawn), it has to call @ref rebuild.
+ */
+class ray_batch
+{
+    public:
+        /** Reads the tiles up to range away from the origin, on its z-level. */
+        ray_batch( const tripoint &origin, int range );
+
+        /** Adds a ray from the origin to the target, which must be on the same z-level. */
+        void add_ray( const tripoint &target );
+        /** Computes the paths of the rays and the first tile that may stop each of them. */
+        void trace();
+
+        size_t size() const {
+            return first_hits.size();
+        }
+        /** Number of tiles on the path of the ray, the origin is not part of it. */
+        size_t length( size_t ray ) const {
+            return path_starts[ray + 1] - path_starts[ray];
+        }
+        const tripoint &point_at( size_t ray, size_t step ) const {
+            return paths[path_starts[ray] + step];
+        }
+        /**
+         * Index of the first tile at or after step on the path of the ray that may stop it,
+         * or @ref length of the ray if there is none.
+         */
+        size_t next_hit( size_t ray, size_t step ) const;
+
+        /** Reads the tile from the map again, after something changed it. */
+        void refresh( const tripoint &p );
+        /** Reads all tiles from the map again, after something changed more than one tile. */
+        void rebuild();
+
+    private:
+        void read_tiles();
+
+        enum tile_flags : uint8_t {
+            BLOCKED = 1,
+            OCCUPIED = 2,
+        };
+
+        bool inside( const tripoint &p ) const {
+            return p.z == origin.z && abs( p.x - origin.x ) <= range && abs( p.y - origin.y ) <= range;
+        }
+        size_t index( const tripoint &p ) const {
+            return ( p.y - origin.y + range ) * ( 2 * range + 1 ) + ( p.x - origin.x + range );
+        }
+        bool stops( const tripoint &p ) const {
+            return !inside( p ) || tiles[index( p )] != 0;
+        }
+
+        tripoint origin;
+        int range;
+        /** @ref tile_flags for each tile in the square around the origin. */
+        std::vector<uint8_t> tiles;
+        std::vector<tripoint> targets;
+        /** Paths of all rays, one after the other, path_starts has the index of each one. */
+        std::vector<tripoint> paths;
+        std::vector<size_t> path_starts;
+        std::vector<size_t> first_hits;
+        /** Set when a tile that didn't stop rays now does, the first hits may be wrong then. */
+        bool new_stops = false;
+};
+
 #endif
@@ -51,6 +51,7 @@ const skill_id skill_dodge( "dodge" );
 const skill_id skill_throw( "throw" );
 
 static const trait_id trait_ACIDBLOOD( "ACIDBLOOD" );
+static const trait_id trait_ACIDPROOF( "ACIDPROOF" );
 static const trait_id trait_ARACHNID_ARMS( "ARACHNID_ARMS" );
 static const trait_id trait_ARM_TENTACLES_4( "ARM_TENTACLES_4" );
 static const trait_id trait_ARM_TENTACLES_8( "ARM_TENTACLES_8" );
@@ -65,6 +66,7 @@ static const trait_id trait_CHITIN2( "CHITIN2" );
 static const trait_id trait_CHITIN3( "CHITIN3" );
 static const trait_id trait_CHITIN_FUR3( "CHITIN_FUR3" );
 static const trait_id trait_DEBUG_NIGHTVISION( "DEBUG_NIGHTVISION" );
+static const trait_id trait_DEBUG_STORAGE( "DEBUG_STORAGE" );
 static const trait_id trait_DISORGANIZED( "DISORGANIZED" );
 static const trait_id trait_ELFA_FNV( "ELFA_FNV" );
 static const trait_id trait_ELFA_NV( "ELFA_NV" );
@@ -75,13 +77,17 @@ static const trait_id trait_FLIMSY( "FLIMSY" );
 static const trait_id trait_GLASSJAW( "GLASSJAW" );
 static const trait_id trait_HOLLOW_BONES( "HOLLOW_BONES" );
 static const trait_id trait_HUGE( "HUGE" );
+static const trait_id trait_INFRARED( "INFRARED" );
 static const trait_id trait_INSECT_ARMS( "INSECT_ARMS" );
 static const trait_id trait_LIGHT_BONES( "LIGHT_BONES" );
+static const trait_id trait_LIZ_IR( "LIZ_IR" );
 static const trait_id trait_MEMBRANE( "MEMBRANE" );
 static const trait_id trait_MUT_TOUGH2( "MUT_TOUGH2" );
 static const trait_id trait_MUT_TOUGH3( "MUT_TOUGH3" );
 static const trait_id trait_MUT_TOUGH( "MUT_TOUGH" );
 static const trait_id trait_MYOPIC( "MYOPIC" );
+static const trait_id trait_M_IMMUNE( "M_IMMUNE" );
+static const trait_id trait_M_SKIN2( "M_SKIN2" );
 static const trait_id trait_NIGHTVISION2( "NIGHTVISION2" );
 static const trait_id trait_NIGHTVISION3( "NIGHTVISION3" );
 static const trait_id trait_NIGHTVISION( "NIGHTVISION" );
@@ -107,10 +113,37 @@ static const trait_id trait_TOUGH3( "TOUGH3" );
 static const trait_id trait_TOUGH( "TOUGH" );
 static const trait_id trait_URSINE_EYE( "URSINE_EYE" );
 static const trait_id trait_WEBBED( "WEBBED" );
+static const trait_id trait_WEB_WALKER( "WEB_WALKER" );
 static const trait_id trait_WINGS_BAT( "WINGS_BAT" );
 static const trait_id trait_WINGS_BUTTERFLY( "WINGS_BUTTERFLY" );
 static const trait_id debug_nodmg( "DEBUG_NODMG" );
 
+static const bionic_id bio_blindfold( "bio_blindfold" );
+static const bionic_id bio_dex_enhancer( "bio_dex_enhancer" );
+static const bionic_id bio_eye_enhancer( "bio_eye_enhancer" );
+static const bionic_id bio_heatsink( "bio_heatsink" );
+static const bionic_id bio_hydraulics( "bio_hydraulics" );
+static const bionic_id bio_infrared( "bio_infrared" );
+static const bionic_id bio_int_enhancer( "bio_int_enhancer" );
+static const bionic_id bio_leukocyte( "bio_leukocyte" );
+static const bionic_id bio_membrane( "bio_membrane" );
+static const bionic_id bio_night_vision( "bio_night_vision" );
+static const bionic_id bio_nostril( "bio_nostril" );
+static const bionic_id bio_pokedeye( "bio_pokedeye" );
+static const bionic_id bio_railgun( "bio_railgun" );
+static const bionic_id bio_stiff( "bio_stiff" );
+static const bionic_id bio_storage( "bio_storage" );
+static const bionic_id bio_str_enhancer( "bio_str_enhancer" );
+static const bionic_id bio_thumbs( "bio_thumbs" );
+
+static const material_id mat_flesh( "flesh" );
+static const material_id mat_hflesh( "hflesh" );
+static const material_id mat_iron( "iron" );
+static const material_id mat_steel( "steel" );
+
+static const flag_id flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
+static const flag_id flag_SPEEDLOADER( "SPEEDLOADER" );
+
 Character::Character() : Creature(), visitable<Character>(), hp_cur(
 {{
         0
@@ -211,7 +244,7 @@ std::pair<int, int> Character::get_fastest_sight( const item &gun, double recoil
     int sight_speed_modifier = INT_MIN;
     int limit = 0;
     if( effective_dispersion( gun.type->gun->sight_dispersion ) < recoil ) {
-        sight_speed_modifier = gun.has_flag( "DISABLE_SIGHTS" ) ? 0 : 6;
+        sight_speed_modifier = gun.has_flag( flag_DISABLE_SIGHTS ) ? 0 : 6;
         limit = effective_dispersion( gun.type->gun->sight_dispersion );
     }
 
@@ -533,7 +566,7 @@ void Character::recalc_sight_limits()
         sight_max = 1;
         vision_mode_cache.set( BOOMERED );
     } else if (has_effect( effect_in_pit ) ||
-            (underwater && !has_bionic( bionic_id( "bio_membrane" ) ) &&
+            (underwater && !has_bionic( bio_membrane ) &&
                 !has_trait( trait_MEMBRANE ) && !worn_with_flag("SWIM_GOGGLES") &&
                 !has_trait( trait_CEPH_EYES ) && !has_trait( trait_PER_SLIME_OK ) ) ) {
         sight_max = 1;
@@ -587,9 +620,9 @@ void Character::recalc_sight_limits()
     }
 
     // Not exactly a sight limit thing, but related enough
-    if( has_active_bionic( bionic_id( "bio_infrared" ) ) ||
-        has_trait( trait_id( "INFRARED" ) ) ||
-        has_trait( trait_id( "LIZ_IR" ) ) ||
+    if( has_active_bionic( bio_infrared ) ||
+        has_trait( trait_INFRARED ) ||
+        has_trait( trait_LIZ_IR ) ||
         worn_with_flag( "IR_EFFECT" ) ) {
         vision_mode_cache.set( IR_VISION );
     }
@@ -957,7 +990,7 @@ void find_ammo_helper( T& src, const item& obj, bool empty, Output out, bool nes
             if( node->is_ammo() && node->type->ammo->type.count( ammo ) ) {
                 out = item_location( src, node );
             }
-            if( node->is_magazine() && node->has_flag( "SPEEDLOADER" ) ) {
+            if( node->is_magazine() && node->has_flag( flag_SPEEDLOADER ) ) {
                 if( mags.count( node->typeId() ) && node->ammo_remaining() ) {
                     out = item_location( src, node );
                 }
@@ -1019,7 +1052,7 @@ units::volume Character::volume_carried() const
 
 units::mass Character::weight_capacity() const
 {
-    if( has_trait( trait_id( "DEBUG_STORAGE" ) ) ) {
+    if( has_trait( trait_DEBUG_STORAGE ) ) {
         // Infinite enough
         return units::mass_max;
     }
@@ -1028,16 +1061,16 @@ units::mass Character::weight_capacity() const
     units::mass ret = Creature::weight_capacity();
     /** @EFFECT_STR increases carrying capacity */
     ret += get_str() * 4_kilogram;
-    if( has_trait( trait_id( "BADBACK" ) ) ) {
+    if( has_trait( trait_BADBACK ) ) {
         ret = ret * .65;
     }
-    if( has_trait( trait_id( "STRONGBACK" ) ) ) {
+    if( has_trait( trait_STRONGBACK ) ) {
         ret = ret * 1.35;
     }
-    if( has_trait( trait_id( "LIGHT_BONES" ) ) ) {
+    if( has_trait( trait_LIGHT_BONES ) ) {
         ret = ret * .80;
     }
-    if( has_trait( trait_id( "HOLLOW_BONES" ) ) ) {
+    if( has_trait( trait_HOLLOW_BONES ) ) {
         ret = ret * .60;
     }
     if (has_artifact_with(AEP_CARRY_MORE)) {
@@ -1056,7 +1089,7 @@ units::volume Character::volume_capacity() const
 
 units::volume Character::volume_capacity_reduced_by( units::volume mod ) const
 {
-    if( has_trait( trait_id( "DEBUG_STORAGE" ) ) ) {
+    if( has_trait( trait_DEBUG_STORAGE ) ) {
         return units::volume_max;
     }
 
@@ -1064,7 +1097,7 @@ units::volume Character::volume_capacity_reduced_by( units::volume mod ) const
     for (auto &i : worn) {
         ret += i.get_storage();
     }
-    if( has_bionic( bionic_id( "bio_storage" ) ) ) {
+    if( has_bionic( bio_storage ) ) {
         ret += 2000_ml;
     }
     if( has_trait( trait_SHELL ) ) {
@@ -1094,7 +1127,7 @@ bool Character::can_pickWeight( const item &it, bool safe ) const
     if (!safe)
     {
         // Character can carry up to four times their maximum weight
-        return ( weight_carried() + it.weight() <= ( has_trait( trait_id( "DEBUG_STORAGE" ) ) ? units::mass_max : weight_capacity() * 4 ) );
+        return ( weight_carried() + it.weight() <= ( has_trait( trait_DEBUG_STORAGE ) ? units::mass_max : weight_capacity() * 4 ) );
     }
     else
     {
@@ -1322,15 +1355,15 @@ void Character::die(Creature* nkiller)
 void Character::reset_stats()
 {
     // Bionic buffs
-    if (has_active_bionic( bionic_id( "bio_hydraulics" ) ) )
+    if (has_active_bionic( bio_hydraulics ) )
         mod_str_bonus(20);
-    if (has_bionic( bionic_id( "bio_eye_enhancer" ) ) )
+    if (has_bionic( bio_eye_enhancer ) )
         mod_per_bonus(2);
-    if (has_bionic( bionic_id( "bio_str_enhancer" ) ) )
+    if (has_bionic( bio_str_enhancer ) )
         mod_str_bonus(2);
-    if (has_bionic( bionic_id( "bio_int_enhancer" ) ) )
+    if (has_bionic( bio_int_enhancer ) )
         mod_int_bonus(2);
-    if (has_bionic( bionic_id( "bio_dex_enhancer" ) ) )
+    if (has_bionic( bio_dex_enhancer ) )
         mod_dex_bonus(2);
 
     // Trait / mutation buffs
@@ -1428,7 +1461,7 @@ bool Character::has_nv()
     if( !nv_cached ) {
         nv_cached = true;
         nv = (worn_with_flag("GNV_EFFECT") ||
-              has_active_bionic( bionic_id( "bio_night_vision" ) ) );
+              has_active_bionic( bio_night_vision ) );
     }
 
     return nv;
@@ -1603,7 +1636,7 @@ void apply_mut_encumbrance( std::array<encumbrance_data, num_bp> &vals,
 
 void Character::mut_cbm_encumb( std::array<encumbrance_data, num_bp> &vals ) const
 {
-    if( has_bionic( bionic_id( "bio_stiff" ) ) ) {
+    if( has_bionic( bio_stiff ) ) {
         // All but head, mouth and eyes
         for( auto &val : vals ) {
             val.encumbrance += 10;
@@ -1614,14 +1647,14 @@ void Character::mut_cbm_encumb( std::array<encumbrance_data, num_bp> &vals ) con
         vals[bp_eyes].encumbrance -= 10;
     }
 
-    if( has_bionic( bionic_id( "bio_nostril" ) ) ) {
+    if( has_bionic( bio_nostril ) ) {
         vals[bp_mouth].encumbrance += 10;
     }
-    if( has_bionic( bionic_id( "bio_thumbs" ) ) ) {
+    if( has_bionic( bio_thumbs ) ) {
         vals[bp_hand_l].encumbrance += 10;
         vals[bp_hand_r].encumbrance += 10;
     }
-    if( has_bionic( bionic_id( "bio_pokedeye" ) ) ) {
+    if( has_bionic( bio_pokedeye ) ) {
         vals[bp_eyes].encumbrance += 10;
     }
 
@@ -1918,7 +1951,7 @@ void Character::update_health(int external_modifiers)
 
     // Active leukocyte breeder will keep your health near 100
     int effective_healthy_mod = get_healthy_mod();
-    if( has_active_bionic( bionic_id( "bio_leukocyte" ) ) ) {
+    if( has_active_bionic( bio_leukocyte ) ) {
         // Side effect: dependency
         mod_healthy_mod( -50, -200 );
         effective_healthy_mod = 100;
@@ -2203,12 +2236,12 @@ bool Character::is_immune_field( const field_id fid ) const
         case fd_relax_gas:
             return get_env_resist( bp_mouth ) >= 15;
         case fd_fungal_haze:
-            return has_trait( trait_id( "M_IMMUNE" ) ) || ( get_env_resist( bp_mouth ) >= 15 &&
+            return has_trait( trait_M_IMMUNE ) || ( get_env_resist( bp_mouth ) >= 15 &&
                    get_env_resist( bp_eyes ) >= 15);
         case fd_electricity:
             return is_elec_immune();
         case fd_acid:
-            return has_trait( trait_id( "ACIDPROOF" ) ) ||
+            return has_trait( trait_ACIDPROOF ) ||
                    (!is_on_ground() && get_env_resist( bp_foot_l ) >= 15 &&
                    get_env_resist( bp_foot_r ) >= 15 &&
                    get_env_resist( bp_leg_l ) >= 15 &&
@@ -2218,10 +2251,10 @@ bool Character::is_immune_field( const field_id fid ) const
                    get_armor_type( DT_ACID, bp_leg_l ) >= 5 &&
                    get_armor_type( DT_ACID, bp_leg_r ) >= 5 );
         case fd_web:
-            return has_trait( trait_id( "WEB_WALKER" ) );
+            return has_trait( trait_WEB_WALKER );
         case fd_fire:
         case fd_flame_burst:
-            return has_trait( trait_id( "M_SKIN2" ) ) || has_active_bionic( bionic_id( "bio_heatsink" ) ) ||
+            return has_trait( trait_M_SKIN2 ) || has_active_bionic( bio_heatsink ) ||
                    is_wearing( "rm13_armor_on" );
         default:
             // Suppress warning
@@ -2251,8 +2284,8 @@ int Character::throw_range( const item &it ) const
     /** @EFFECT_STR increases throwing range, vs item weight (high or low) */
     int ret = ( str_cur * 8 ) / ( tmp.weight() >= 150_gram ? tmp.weight() / 113_gram : 10 - int( tmp.weight() / 15_gram ) );
     ret -= tmp.volume() / 1000_ml;
-    static const std::set<material_id> affected_materials = { material_id( "iron" ), material_id( "steel" ) };
-    if( has_active_bionic( bionic_id( "bio_railgun" ) ) && tmp.made_of_any( affected_materials ) ) {
+    static const std::set<material_id> affected_materials = { mat_iron, mat_steel };
+    if( has_active_bionic( bio_railgun ) && tmp.made_of_any( affected_materials ) ) {
         ret *= 2;
     }
     if( ret < 1 ) {
@@ -2271,7 +2304,7 @@ int Character::throw_range( const item &it ) const
 
 bool Character::made_of( const material_id &m ) const {
     // TODO: check for mutations that change this.
-    static const std::vector<material_id> fleshy = { material_id( "flesh" ), material_id( "hflesh" ) };
+    static const std::vector<material_id> fleshy = { mat_flesh, mat_hflesh };
     return std::find( fleshy.begin(), fleshy.end(), m ) != fleshy.end();
 }
 
@@ -2279,7 +2312,7 @@ bool Character::is_blind() const
 {
     return ( worn_with_flag( "BLIND" ) ||
              has_effect( effect_blind ) ||
-             has_active_bionic( bionic_id( "bio_blindfold" ) ) );
+             has_active_bionic( bio_blindfold ) );
 }
 
 bool Character::pour_into( item &container, item &liquid )
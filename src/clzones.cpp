@@ -8,8 +8,81 @@
 #include "ui.h"
 #include "string_input_popup.h"
 
+#include <algorithm>
 #include <iostream>
 
+void zone_box_index::insert( const tripoint &min, const tripoint &max )
+{
+    if( min.x > max.x || min.y > max.y || min.z > max.z ) {
+        return;
+    }
+
+    const auto pos = std::upper_bound( boxes.begin(), boxes.end(), min.x,
+    []( const int x, const box & b ) {
+        return x < b.min.x;
+    } );
+    const size_t index = pos - boxes.begin();
+    boxes.insert( pos, box{ min, max } );
+    reach.push_back( 0 );
+    update_reach( index );
+}
+
+void zone_box_index::erase( const tripoint &min, const tripoint &max )
+{
+    const auto pos = std::find_if( boxes.begin(), boxes.end(), [&]( const box & b ) {
+        return b.min == min && b.max == max;
+    } );
+    if( pos == boxes.end() ) {
+        return;
+    }
+    const size_t index = pos - boxes.begin();
+    boxes.erase( pos );
+    reach.pop_back();
+    update_reach( index );
+}
+
+void zone_box_index::update_reach( const size_t from )
+{
+    for( size_t i = from; i < boxes.size(); i++ ) {
+        reach[i] = i == 0 ? boxes[i].max.x : std::max( reach[i - 1], boxes[i].max.x );
+    }
+}
+
+bool zone_box_index::contains( const tripoint &p ) const
+{
+    const auto pos = std::upper_bound( boxes.begin(), boxes.end(), p.x,
+    []( const int x, const box & b ) {
+        return x < b.min.x;
+    } );
+    for( size_t i = pos - boxes.begin(); i-- > 0; ) {
+        if( reach[i] < p.x ) {
+            // None of the boxes from here on west reach p
+            return false;
+        }
+        const box &b = boxes[i];
+        if( p.x <= b.max.x && p.y >= b.min.y && p.y <= b.max.y &&
+            p.z >= b.min.z && p.z <= b.max.z ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unordered_set<tripoint> zone_box_index::get_points() const
+{
+    std::unordered_set<tripoint> points;
+    for( const box &b : boxes ) {
+        for( int x = b.min.x; x <= b.max.x; ++x ) {
+            for( int y = b.min.y; y <= b.max.y; ++y ) {
+                for( int z = b.min.z; z <= b.max.z; ++z ) {
+                    points.insert( tripoint( x, y, z ) );
+                }
+            }
+        }
+    }
+    return points;
+}
+
 zone_manager::zone_manager()
 {
     types.emplace( zone_type_id( "NO_AUTO_PICKUP" ),
@@ -80,39 +153,33 @@ bool zone_manager::has_type( const zone_type_id &type ) const
 
 void zone_manager::cache_data()
 {
-    area_cache.clear();
+    area_index.clear();
 
     for( auto &elem : zones ) {
-        if( !elem.get_enabled() ) {
-            continue;
-        }
-
-        const zone_type_id &type = elem.get_type();
-        auto &cache = area_cache[type];
-
-        tripoint start = elem.get_start_point();
-        tripoint end = elem.get_end_point();
-
-        // Draw marked area
-        for( int x = start.x; x <= end.x; ++x ) {
-            for( int y = start.y; y <= end.y; ++y ) {
-                for( int z = start.z; z <= end.z; ++z ) {
-                    cache.insert( tripoint( x, y, z ) );
-                }
-            }
+        if( elem.get_enabled() ) {
+            area_index[elem.get_type()].insert( elem.get_start_point(), elem.get_end_point() );
         }
     }
 }
 
 bool zone_manager::has( const zone_type_id &type, const tripoint &where ) const
 {
-    const auto &type_iter = area_cache.find( type );
-    if( type_iter == area_cache.end() ) {
+    const auto &type_iter = area_index.find( type );
+    if( type_iter == area_index.end() ) {
         return false;
     }
 
-    const auto &point_set = type_iter->second;;
-    return point_set.find( where ) != point_set.end();
+    return type_iter->second.contains( where );
+}
+
+std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type ) const
+{
+    const auto &type_iter = area_index.find( type );
+    if( type_iter == area_index.end() ) {
+        return std::unordered_set<tripoint>();
+    }
+
+    return type_iter->second.get_points();
 }
 
 void zone_manager::add( const std::string &name, const zone_type_id &type,
@@ -120,7 +187,26 @@ void zone_manager::add( const std::string &name, const zone_type_id &type,
                         const tripoint &start, const tripoint &end )
 {
     zones.push_back( zone_data( name, type, invert, enabled, start, end ) );
-    cache_data();
+    if( enabled ) {
+        area_index[type].insert( start, end );
+    }
+}
+
+bool zone_manager::remove( const size_t index )
+{
+    if( index >= zones.size() ) {
+        return false;
+    }
+
+    const zone_data &zone = zones[index];
+    if( zone.get_enabled() ) {
+        const auto &type_iter = area_index.find( zone.get_type() );
+        if( type_iter != area_index.end() ) {
+            type_iter->second.erase( zone.get_start_point(), zone.get_end_point() );
+        }
+    }
+    zones.erase( zones.begin() + index );
+    return true;
 }
 
 void zone_manager::serialize( JsonOut &json ) const
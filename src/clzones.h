@@ -25,6 +25,38 @@ class zone_type
 };
 using zone_type_id = string_id<zone_type>;
 
+/**
+ * The boxes covered by the zones of one type. They are kept sorted by their west edge,
+ * so a lookup only looks at the boxes that start west of the point, and stops once the
+ * remaining ones all end before it.
+ */
+class zone_box_index
+{
+    public:
+        /** Adds the box from min to max (inclusive), does nothing if it is empty. */
+        void insert( const tripoint &min, const tripoint &max );
+        /** Removes one box from min to max that was added before. */
+        void erase( const tripoint &min, const tripoint &max );
+        bool contains( const tripoint &p ) const;
+        bool empty() const {
+            return boxes.empty();
+        }
+        /** All points in any of the boxes. */
+        std::unordered_set<tripoint> get_points() const;
+
+    private:
+        struct box {
+            tripoint min;
+            tripoint max;
+        };
+        /** Sorted by min.x. */
+        std::vector<box> boxes;
+        /** reach[i] is the highest max.x of boxes[0] to boxes[i]. */
+        std::vector<int> reach;
+
+        void update_reach( size_t from );
+};
+
 /**
  * These are zones the player can designate.
  *
@@ -35,7 +67,7 @@ class zone_manager
 {
     private:
         std::map<zone_type_id, zone_type> types;
-        std::unordered_map<zone_type_id, std::unordered_set<tripoint>> area_cache;
+        std::unordered_map<zone_type_id, zone_box_index> area_index;
 
     public:
         zone_manager();
@@ -103,14 +135,7 @@ class zone_manager
                   const bool invert, const bool enabled,
                   const tripoint &start, const tripoint &end );
 
-        bool remove( const size_t index ) {
-            if( index < zones.size() ) {
-                zones.erase( zones.begin() + index );
-                return true;
-            }
-
-            return false;
-        }
+        bool remove( const size_t index );
 
         unsigned int size() const {
             return zones.size();
@@ -120,8 +145,14 @@ class zone_manager
         }
         std::string get_name_from_type( const zone_type_id &type ) const;
         bool has_type( const zone_type_id &type ) const;
+        /**
+         * Builds the index of the enabled zones again, which is needed after zones were
+         * changed directly. @ref add and @ref remove keep it up to date themselves.
+         */
         void cache_data();
         bool has( const zone_type_id &type, const tripoint &where ) const;
+        /** All points in enabled zones of the given type, worked out when asked for. */
+        std::unordered_set<tripoint> get_point_set( const zone_type_id &type ) const;
 
         bool save_zones();
         void load_zones();
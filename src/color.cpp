@@ -9,6 +9,7 @@
 #include "ui.h"
 #include "translations.h"
 #include "json.h"
+#include "rng.h"
 
 #include <algorithm> // for std::count
 #include <iostream>
@@ -33,6 +34,9 @@ std::unordered_map<std::string, note_color> color_by_string_map;
 
 void color_manager::finalize()
 {
+    // Texts that were already parsed may refer to the old colors
+    clear_colored_text_cache();
+
     static const std::array<std::string, NUM_HL> hilights = {{
             "",
             "red",
@@ -168,7 +172,7 @@ nc_color color_manager::get_invert( const nc_color col ) const
 nc_color color_manager::get_random() const
 {
     auto item = color_array.begin();
-    std::advance( item, rand() % num_colors );
+    std::advance( item, rng( 0, num_colors - 1 ) );
 
     return item->color;
 }
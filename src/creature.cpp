@@ -33,6 +33,14 @@ const efftype_id effect_stunned( "stunned" );
 const efftype_id effect_zapped( "zapped" );
 const efftype_id effect_lying_down( "lying_down" );
 
+static const material_id mat_cotton( "cotton" );
+static const material_id mat_flesh( "flesh" );
+static const material_id mat_iflesh( "iflesh" );
+static const material_id mat_paper( "paper" );
+static const material_id mat_veggy( "veggy" );
+static const material_id mat_wood( "wood" );
+static const material_id mat_wool( "wool" );
+
 const std::map<std::string, m_size> Creature::size_map = {
     {"TINY", MS_TINY}, {"SMALL", MS_SMALL}, {"MEDIUM", MS_MEDIUM},
     {"LARGE", MS_LARGE}, {"HUGE", MS_HUGE} };
@@ -529,28 +537,28 @@ void Creature::deal_projectile_attack( Creature *source, dealt_projectile_attack
 
     // Apply ammo effects to target.
     if (proj.proj_effects.count("FLAME")) {
-        if (made_of( material_id( "veggy" ) ) || made_of( material_id( "cotton" ) ) ||
-            made_of( material_id( "wool" ) ) || made_of( material_id( "paper" ) ) ||
-            made_of( material_id( "wood" ) ) ) {
+        if (made_of( mat_veggy ) || made_of( mat_cotton ) ||
+            made_of( mat_wool ) || made_of( mat_paper ) ||
+            made_of( mat_wood ) ) {
             add_effect( effect_onfire, rng( 8_turns, 20_turns ), bp_hit );
-        } else if (made_of( material_id( "flesh" ) ) || made_of( material_id( "iflesh" ) ) ) {
+        } else if (made_of( mat_flesh ) || made_of( mat_iflesh ) ) {
             add_effect( effect_onfire, rng( 5_turns, 10_turns ), bp_hit );
         }
     } else if (proj.proj_effects.count("INCENDIARY") ) {
-        if (made_of( material_id( "veggy" ) ) || made_of( material_id( "cotton" ) ) ||
-            made_of( material_id( "wool" ) ) || made_of( material_id( "paper" ) ) ||
-            made_of( material_id( "wood" ) ) ) {
+        if (made_of( mat_veggy ) || made_of( mat_cotton ) ||
+            made_of( mat_wool ) || made_of( mat_paper ) ||
+            made_of( mat_wood ) ) {
             add_effect( effect_onfire, rng( 2_turns, 6_turns ), bp_hit );
-        } else if ( (made_of( material_id( "flesh" ) ) || made_of( material_id( "iflesh" ) ) ) &&
+        } else if ( (made_of( mat_flesh ) || made_of( mat_iflesh ) ) &&
                     one_in(4) ) {
             add_effect( effect_onfire, rng( 1_turns, 4_turns ), bp_hit );
         }
     } else if (proj.proj_effects.count("IGNITE")) {
-        if (made_of( material_id( "veggy" ) ) || made_of( material_id( "cotton" ) ) ||
-            made_of( material_id( "wool" ) ) || made_of( material_id( "paper" ) ) ||
-            made_of( material_id( "wood" ) ) ) {
+        if (made_of( mat_veggy ) || made_of( mat_cotton ) ||
+            made_of( mat_wool ) || made_of( mat_paper ) ||
+            made_of( mat_wood ) ) {
             add_effect( effect_onfire, 6_turns, bp_hit );
-        } else if (made_of( material_id( "flesh" ) ) || made_of( material_id( "iflesh" ) ) ) {
+        } else if (made_of( mat_flesh ) || made_of( mat_iflesh ) ) {
             add_effect( effect_onfire, 10_turns, bp_hit );
         }
     }
@@ -757,45 +765,41 @@ void Creature::add_effect( const efftype_id &eff_id, const time_duration dur, bo
 
     bool found = false;
     // Check if we already have it
-    auto matching_map = effects->find(eff_id);
-    if (matching_map != effects->end()) {
-        auto &bodyparts = matching_map->second;
-        auto found_effect = bodyparts.find(bp);
-        if (found_effect != bodyparts.end()) {
-            found = true;
-            effect &e = found_effect->second;
-            const int prev_int = e.get_intensity();
-            // If we do, mod the duration, factoring in the mod value
-            e.mod_duration( dur * e.get_dur_add_perc() / 100);
-            // Limit to max duration
-            if( e.get_max_duration() > 0_turns && e.get_duration() > e.get_max_duration() ) {
-                e.set_duration( e.get_max_duration() );
-            }
-            // Adding a permanent effect makes it permanent
-            if( e.is_permanent() ) {
-                e.pause_effect();
-            }
-            // int_dur_factor overrides all other intensity settings
-            // ...but it's handled in set_duration, so explicitly do nothing here
-            if( e.get_int_dur_factor() > 0_turns ) {
-                // Set intensity if value is given
-            } else if (intensity > 0) {
-                e.set_intensity(intensity);
-                // Else intensity uses the type'd step size if it already exists
-            } else if (e.get_int_add_val() != 0) {
-                e.mod_intensity(e.get_int_add_val());
-            }
+    effect *found_effect = effects->find( eff_id, bp );
+    if( found_effect != nullptr ) {
+        found = true;
+        effect &e = *found_effect;
+        const int prev_int = e.get_intensity();
+        // If we do, mod the duration, factoring in the mod value
+        e.mod_duration( dur * e.get_dur_add_perc() / 100);
+        // Limit to max duration
+        if( e.get_max_duration() > 0_turns && e.get_duration() > e.get_max_duration() ) {
+            e.set_duration( e.get_max_duration() );
+        }
+        // Adding a permanent effect makes it permanent
+        if( e.is_permanent() ) {
+            e.pause_effect();
+        }
+        // int_dur_factor overrides all other intensity settings
+        // ...but it's handled in set_duration, so explicitly do nothing here
+        if( e.get_int_dur_factor() > 0_turns ) {
+            // Set intensity if value is given
+        } else if (intensity > 0) {
+            e.set_intensity(intensity);
+            // Else intensity uses the type'd step size if it already exists
+        } else if (e.get_int_add_val() != 0) {
+            e.mod_intensity(e.get_int_add_val());
+        }
 
-            // Bound intensity by [1, max intensity]
-            if (e.get_intensity() < 1) {
-                add_msg( m_debug, "Bad intensity, ID: %s", e.get_id().c_str() );
-                e.set_intensity(1);
-            } else if (e.get_intensity() > e.get_max_intensity()) {
-                e.set_intensity(e.get_max_intensity());
-            }
-            if( e.get_intensity() != prev_int ) {
-                on_effect_int_change( eff_id, e.get_intensity(), bp );
-            }
+        // Bound intensity by [1, max intensity]
+        if (e.get_intensity() < 1) {
+            add_msg( m_debug, "Bad intensity, ID: %s", e.get_id().c_str() );
+            e.set_intensity(1);
+        } else if (e.get_intensity() > e.get_max_intensity()) {
+            e.set_intensity(e.get_max_intensity());
+        }
+        if( e.get_intensity() != prev_int ) {
+            on_effect_int_change( eff_id, e.get_intensity(), bp );
         }
     }
 
@@ -803,13 +807,11 @@ void Creature::add_effect( const efftype_id &eff_id, const time_duration dur, bo
         // If we don't already have it then add a new one
 
         // Then check if the effect is blocked by another
-        for( auto &elem : *effects ) {
-            for( auto &_effect_it : elem.second ) {
-                for( const auto blocked_effect : _effect_it.second.get_blocks_effects() ) {
-                    if (blocked_effect == eff_id) {
-                        // The effect is blocked by another, return
-                        return;
-                    }
+        for( const effect &elem : *effects ) {
+            for( const auto blocked_effect : elem.get_blocks_effects() ) {
+                if (blocked_effect == eff_id) {
+                    // The effect is blocked by another, return
+                    return;
                 }
             }
         }
@@ -833,7 +835,7 @@ void Creature::add_effect( const efftype_id &eff_id, const time_duration dur, bo
         } else if (e.get_intensity() > e.get_max_intensity()) {
             e.set_intensity(e.get_max_intensity());
         }
-        ( *effects )[eff_id][bp] = e;
+        effects->insert( e );
         if (is_player()) {
             // Only print the message if we didn't already have it
             if( !type.get_apply_message().empty() ) {
@@ -868,11 +870,8 @@ bool Creature::add_env_effect( const efftype_id &eff_id, body_part vector, int s
 }
 void Creature::clear_effects()
 {
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            const effect &e = _effect_it.second;
-            on_effect_int_change( e.get_id(), 0, e.get_bp() );
-        }
+    for( const effect &e : *effects ) {
+        on_effect_int_change( e.get_id(), 0, e.get_bp() );
     }
     effects->clear();
 }
@@ -898,17 +897,14 @@ bool Creature::remove_effect( const efftype_id &eff_id, body_part bp )
 
     // num_bp means remove all of a given effect id
     if (bp == num_bp) {
-        for( auto &it : ( *effects )[eff_id] ) {
-            on_effect_int_change( eff_id, 0, it.first );
+        const auto range = effects->equal_range( eff_id );
+        for( auto it = range.first; it != range.second; ++it ) {
+            on_effect_int_change( eff_id, 0, it->get_bp() );
         }
-        effects->erase(eff_id);
+        effects->erase( eff_id );
     } else {
-        ( *effects )[eff_id].erase(bp);
+        effects->erase( eff_id, bp );
         on_effect_int_change( eff_id, 0, bp );
-        // If there are no more effects of a given type remove the type map
-        if (( *effects )[eff_id].empty()) {
-            effects->erase(eff_id);
-        }
     }
     return true;
 }
@@ -916,16 +912,9 @@ bool Creature::has_effect( const efftype_id &eff_id, body_part bp ) const
 {
     // num_bp means anything targeted or not
     if (bp == num_bp) {
-        return effects->find( eff_id ) != effects->end();
+        return effects->has( eff_id );
     } else {
-        auto got_outer = effects->find(eff_id);
-        if(got_outer != effects->end()) {
-            auto got_inner = got_outer->second.find(bp);
-            if (got_inner != got_outer->second.end()) {
-                return true;
-            }
-        }
-        return false;
+        return effects->find( eff_id, bp ) != nullptr;
     }
 }
 
@@ -936,12 +925,9 @@ effect &Creature::get_effect( const efftype_id &eff_id, body_part bp )
 
 const effect &Creature::get_effect( const efftype_id &eff_id, body_part bp ) const
 {
-    auto got_outer = effects->find(eff_id);
-    if(got_outer != effects->end()) {
-        auto got_inner = got_outer->second.find(bp);
-        if (got_inner != got_outer->second.end()) {
-            return got_inner->second;
-        }
+    const effect *got = effects->find( eff_id, bp );
+    if( got != nullptr ) {
+        return *got;
     }
     return effect::null_effect;
 }
@@ -972,21 +958,18 @@ void Creature::process_effects()
     std::vector<body_part> rem_bps;
 
     // Decay/removal of effects
-    for( auto &elem : *effects ) {
-        for( auto &_it : elem.second ) {
-            // Add any effects that others remove to the removal list
-            for( const auto removed_effect : _it.second.get_removes_effects() ) {
-                rem_ids.push_back( removed_effect );
-                rem_bps.push_back(num_bp);
-            }
-            effect &e = _it.second;
-            const int prev_int = e.get_intensity();
-            // Run decay effects, marking effects for removal as necessary.
-            e.decay( rem_ids, rem_bps, calendar::turn, is_player() );
+    for( effect &e : *effects ) {
+        // Add any effects that others remove to the removal list
+        for( const auto removed_effect : e.get_removes_effects() ) {
+            rem_ids.push_back( removed_effect );
+            rem_bps.push_back(num_bp);
+        }
+        const int prev_int = e.get_intensity();
+        // Run decay effects, marking effects for removal as necessary.
+        e.decay( rem_ids, rem_bps, calendar::turn, is_player() );
 
-            if( e.get_intensity() != prev_int && e.get_duration() > 0_turns ) {
-                on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
-            }
+        if( e.get_intensity() != prev_int && e.get_duration() > 0_turns ) {
+            on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
         }
     }
 
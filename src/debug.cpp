@@ -10,6 +10,7 @@
 #include <cstdarg>
 #include <iosfwd>
 #include <fstream>
+#include <sstream>
 #include <streambuf>
 #include <sys/stat.h>
 #include <exception>
@@ -48,6 +49,49 @@ std::set<std::string> ignored_messages;
 
 }
 
+struct debug_message_buffer::message {
+    /** Whether it came from debugmsg, otherwise from DebugLog. */
+    bool is_debugmsg;
+    DebugLevel level;
+    DebugClass cl;
+    std::string filename;
+    std::string line;
+    std::string funcname;
+    std::ostringstream text;
+};
+
+/** Buffer of the innermost @ref debug_message_buffer::capture of this thread, if any. */
+static thread_local debug_message_buffer *capturing_buffer = nullptr;
+
+debug_message_buffer::debug_message_buffer() = default;
+debug_message_buffer::~debug_message_buffer() = default;
+
+debug_message_buffer::capture::capture( debug_message_buffer &buffer ) :
+    previous( capturing_buffer )
+{
+    capturing_buffer = &buffer;
+}
+
+debug_message_buffer::capture::~capture()
+{
+    capturing_buffer = previous;
+}
+
+void debug_message_buffer::replay()
+{
+    // Taken first, replaying must not add to the messages being replayed
+    const std::vector<std::unique_ptr<message>> replayed = std::move( messages );
+    messages.clear();
+    for( const std::unique_ptr<message> &msg : replayed ) {
+        if( msg->is_debugmsg ) {
+            realDebugmsg( msg->filename.c_str(), msg->line.c_str(), msg->funcname.c_str(),
+                          msg->text.str() );
+        } else {
+            DebugLog( msg->level, msg->cl ) << msg->text.str();
+        }
+    }
+}
+
 void realDebugmsg( const char *filename, const char *line, const char *funcname,
                    const std::string &text )
 {
@@ -55,6 +99,17 @@ void realDebugmsg( const char *filename, const char *line, const char *funcname,
     assert( line != nullptr );
     assert( funcname != nullptr );
 
+    if( capturing_buffer != nullptr ) {
+        std::unique_ptr<debug_message_buffer::message> msg( new debug_message_buffer::message() );
+        msg->is_debugmsg = true;
+        msg->filename = filename;
+        msg->line = line;
+        msg->funcname = funcname;
+        msg->text << text;
+        capturing_buffer->messages.push_back( std::move( msg ) );
+        return;
+    }
+
     if( test_mode ) {
         test_dirty = true;
         std::cerr << filename << ":" << line << " [" << funcname << "] " << text << std::endl;
@@ -359,6 +414,16 @@ std::ofstream &DebugFile::currentTime()
 
 std::ostream &DebugLog( DebugLevel lev, DebugClass cl )
 {
+    if( capturing_buffer != nullptr ) {
+        // Filtered when replayed
+        std::unique_ptr<debug_message_buffer::message> msg( new debug_message_buffer::message() );
+        msg->is_debugmsg = false;
+        msg->level = lev;
+        msg->cl = cl;
+        std::ostream &stream = msg->text;
+        capturing_buffer->messages.push_back( std::move( msg ) );
+        return stream;
+    }
     // Error are always logged, they are important,
     // Messages from D_MAIN come from debugmsg and are equally important.
     if( ( ( lev & debugLevel ) && ( cl & debugClass ) ) || lev & D_ERROR || cl & D_MAIN ) {
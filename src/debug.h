@@ -47,6 +47,7 @@
 // Includes                                                         {{{1
 // ---------------------------------------------------------------------
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #define STRING2(x) #x
@@ -141,6 +142,45 @@ void limitDebugClass( int );
 // See documentation at the top.
 std::ostream &DebugLog( DebugLevel, DebugClass );
 
+/**
+ * Keeps the messages of @ref debugmsg and @ref DebugLog from a worker thread, which must
+ * not show them (only the main thread may use the UI) nor write the log file itself.
+ * They are shown and logged later on the main thread with @ref replay.
+ */
+class debug_message_buffer
+{
+    public:
+        /**
+         * While an instance exists, debugmsg and DebugLog on the thread that created it
+         * write into the buffer instead.
+         */
+        class capture
+        {
+            public:
+                explicit capture( debug_message_buffer &buffer );
+                ~capture();
+
+                capture( const capture & ) = delete;
+                capture &operator=( const capture & ) = delete;
+
+            private:
+                debug_message_buffer *previous;
+        };
+
+        debug_message_buffer();
+        ~debug_message_buffer();
+
+        /** Shows and logs the kept messages on the calling thread in their order, and drops them. */
+        void replay();
+
+    private:
+        friend void realDebugmsg( const char *, const char *, const char *, const std::string & );
+        friend std::ostream &DebugLog( DebugLevel, DebugClass );
+
+        struct message;
+        std::vector<std::unique_ptr<message>> messages;
+};
+
 // OStream operators                                                {{{1
 // ---------------------------------------------------------------------
 
@@ -1780,6 +1780,9 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
                             }
                         }
 
+                        destsm->invalidate_item_summary();
+                        srcsm->invalidate_item_summary();
+
                         // various misc variables
                         destsm->active_items = srcsm->active_items;
 
@@ -1965,8 +1968,6 @@ void editmap::cleartmpmap( tinymap &tmpmap )
         delete smap;
     }
 
-    auto &ch = tmpmap.get_cache( target.z );
-    std::memset( ch.veh_exists_at, 0, sizeof( ch.veh_exists_at ) );
-    ch.veh_cached_parts.clear();
-    ch.vehicle_list.clear();
+    tmpmap.clear_vehicle_cache( target.z );
+    tmpmap.get_cache( target.z ).vehicle_list.clear();
 }
@@ -8,6 +8,7 @@
 #include "messages.h"
 #include "json.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 
@@ -1247,3 +1248,110 @@ void effect::deserialize(JsonIn &jsin)
     start_time = calendar::time_of_cataclysm;
     jo.read( "start_turn", start_time );
 }
+
+effects_map::effects_map( const effects_map &rhs )
+{
+    *this = rhs;
+}
+
+effects_map &effects_map::operator=( const effects_map &rhs )
+{
+    if( this == &rhs ) {
+        return *this;
+    }
+    container copy;
+    copy.reserve( rhs.entries.size() );
+    for( const entry &e : rhs.entries ) {
+        copy.push_back( entry{ e.id, e.bp, std::unique_ptr<effect>( new effect( *e.eff ) ) } );
+    }
+    entries = std::move( copy );
+    return *this;
+}
+
+effects_map::container::const_iterator effects_map::lower_bound( const size_t id,
+        const body_part bp ) const
+{
+    return std::lower_bound( entries.begin(), entries.end(), std::make_pair( id, bp ),
+    []( const entry & e, const std::pair<size_t, body_part> &key ) {
+        return e.id < key.first || ( e.id == key.first && e.bp < key.second );
+    } );
+}
+
+effect *effects_map::find( const efftype_id &id, const body_part bp )
+{
+    return const_cast<effect *>( const_cast<const effects_map *>( this )->find( id, bp ) );
+}
+
+const effect *effects_map::find( const efftype_id &id, const body_part bp ) const
+{
+    const auto iter = lower_bound( id.symbol(), bp );
+    if( iter != entries.end() && iter->id == id.symbol() && iter->bp == bp ) {
+        return iter->eff.get();
+    }
+    return nullptr;
+}
+
+bool effects_map::has( const efftype_id &id ) const
+{
+    // body_part values start at 0, so this is the first effect of the type if there is one
+    const auto iter = lower_bound( id.symbol(), static_cast<body_part>( 0 ) );
+    return iter != entries.end() && iter->id == id.symbol();
+}
+
+std::pair<effects_map::const_iterator, effects_map::const_iterator> effects_map::equal_range(
+    const efftype_id &id ) const
+{
+    const size_t key = id.symbol();
+    auto first = lower_bound( key, static_cast<body_part>( 0 ) );
+    auto last = first;
+    while( last != entries.end() && last->id == key ) {
+        ++last;
+    }
+    return std::make_pair( const_iterator( first ), const_iterator( last ) );
+}
+
+std::vector<std::pair<efftype_id, body_part>> effects_map::keys() const
+{
+    std::vector<std::pair<efftype_id, body_part>> result;
+    result.reserve( entries.size() );
+    for( const entry &e : entries ) {
+        result.emplace_back( e.eff->get_id(), e.bp );
+    }
+    return result;
+}
+
+effect &effects_map::insert( const effect &eff )
+{
+    const size_t key = eff.get_id().symbol();
+    const auto iter = entries.begin() + ( lower_bound( key, eff.get_bp() ) - entries.begin() );
+    if( iter != entries.end() && iter->id == key && iter->bp == eff.get_bp() ) {
+        *iter->eff = eff;
+        return *iter->eff;
+    }
+    std::unique_ptr<effect> copy( new effect( eff ) );
+    return *entries.insert( iter, entry{ key, eff.get_bp(), std::move( copy ) } )->eff;
+}
+
+size_t effects_map::erase( const efftype_id &id )
+{
+    const size_t key = id.symbol();
+    const auto first = entries.begin() + ( lower_bound( key, static_cast<body_part>( 0 ) ) -
+                                           entries.begin() );
+    auto last = first;
+    while( last != entries.end() && last->id == key ) {
+        ++last;
+    }
+    const size_t count = last - first;
+    entries.erase( first, last );
+    return count;
+}
+
+bool effects_map::erase( const efftype_id &id, const body_part bp )
+{
+    const auto iter = entries.begin() + ( lower_bound( id.symbol(), bp ) - entries.begin() );
+    if( iter != entries.end() && iter->id == id.symbol() && iter->bp == bp ) {
+        entries.erase( iter );
+        return true;
+    }
+    return false;
+}
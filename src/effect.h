@@ -6,8 +6,11 @@
 #include "calendar.h"
 #include "enums.h"
 #include "string_id.h"
+#include <iterator>
+#include <memory>
 #include <unordered_map>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 class effect_type;
@@ -283,11 +286,117 @@ class effect
 void load_effect_type( JsonObject &jo );
 void reset_effect_types();
 
-// Inheritance here allows forward declaration of the map in class Creature.
-// Storing body_part as an int to make things easier for hash and JSON
-class effects_map : public
-    std::unordered_map<efftype_id, std::unordered_map<body_part, effect, std::hash<int>>>
+/**
+ * The effects of a creature, at most one per effect type and body part.
+ *
+ * Stored as a small vector sorted by the interned effect id and the body part, so
+ * looking up an effect is a binary search over a contiguous array instead of two
+ * hash lookups. The effects themselves are allocated separately: references to an
+ * effect stay valid when other effects are added or removed, which happens while
+ * effects are being processed.
+ * Iteration visits all effects ordered by effect id, effects of the same type are
+ * adjacent.
+ */
+class effects_map
 {
+    private:
+        struct entry {
+            size_t id;
+            body_part bp;
+            std::unique_ptr<effect> eff;
+        };
+        using container = std::vector<entry>;
+
+        template<typename T>
+        class iterator_t : public std::iterator<std::forward_iterator_tag, T>
+        {
+            public:
+                iterator_t() = default;
+                explicit iterator_t( container::const_iterator it ) : it( it ) { }
+
+                T &operator*() const {
+                    return *it->eff;
+                }
+                T *operator->() const {
+                    return it->eff.get();
+                }
+                iterator_t &operator++() {
+                    ++it;
+                    return *this;
+                }
+                iterator_t operator++( int ) {
+                    iterator_t result = *this;
+                    ++it;
+                    return result;
+                }
+                bool operator==( const iterator_t &rhs ) const {
+                    return it == rhs.it;
+                }
+                bool operator!=( const iterator_t &rhs ) const {
+                    return it != rhs.it;
+                }
+
+            private:
+                container::const_iterator it;
+        };
+
+    public:
+        using iterator = iterator_t<effect>;
+        using const_iterator = iterator_t<const effect>;
+
+        effects_map() = default;
+        effects_map( const effects_map &rhs );
+        effects_map( effects_map && ) = default;
+        effects_map &operator=( const effects_map &rhs );
+        effects_map &operator=( effects_map && ) = default;
+
+        iterator begin() {
+            return iterator( entries.begin() );
+        }
+        iterator end() {
+            return iterator( entries.end() );
+        }
+        const_iterator begin() const {
+            return const_iterator( entries.begin() );
+        }
+        const_iterator end() const {
+            return const_iterator( entries.end() );
+        }
+
+        bool empty() const {
+            return entries.empty();
+        }
+        size_t size() const {
+            return entries.size();
+        }
+        void clear() {
+            entries.clear();
+        }
+
+        /** Returns the effect of that type on that body part, or nullptr. */
+        effect *find( const efftype_id &id, body_part bp );
+        const effect *find( const efftype_id &id, body_part bp ) const;
+        /** Returns whether there is an effect of that type on any body part. */
+        bool has( const efftype_id &id ) const;
+        /** Returns the range of all effects of that type. */
+        std::pair<const_iterator, const_iterator> equal_range( const efftype_id &id ) const;
+        /**
+         * Returns the type and body part of all effects. Used to process effects when
+         * processing may add or remove other effects.
+         */
+        std::vector<std::pair<efftype_id, body_part>> keys() const;
+
+        /** Adds the effect, replacing the one of the same type on the same body part. */
+        effect &insert( const effect &eff );
+        /** Removes all effects of that type. Returns the number of removed effects. */
+        size_t erase( const efftype_id &id );
+        /** Removes the effect of that type on that body part. Returns whether there was one. */
+        bool erase( const efftype_id &id, body_part bp );
+
+    private:
+        container::const_iterator lower_bound( size_t id, body_part bp ) const;
+
+        container entries;
 };
 
 #endif
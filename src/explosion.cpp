@@ -1,4 +1,5 @@
 #include "explosion.h"
+#include "ballistics.h"
 #include "cata_utility.h"
 #include "game.h"
 #include "map.h"
@@ -10,15 +11,16 @@
 #include "monster.h"
 #include "vpart_position.h"
 #include "output.h"
+#include "rng.h"
 #include "debug.h"
 #include "messages.h"
 #include "translations.h"
 #include "sounds.h"
 #include "vehicle.h"
 #include "field.h"
-#include <queue>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 static const itype_id null_itype( "null" );
 
@@ -63,6 +65,43 @@ shrapnel_data load_shrapnel_data( JsonObject &jo )
 }
 
 // (C1001) Compiler Internal Error on Visual Studio 2015 with Update 2
+namespace
+{
+
+/**
+ * Distances and closed flags of the tiles a blast can touch, in flat arrays over a box
+ * around the center of the blast.
+ */
+struct blast_grid {
+    tripoint min;
+    tripoint max;
+    int size_x;
+    int size_y;
+    /** Shortest known distance to each tile, float max if it wasn't reached yet. */
+    std::vector<float> dist;
+    std::vector<bool> closed;
+
+    blast_grid( const tripoint &min, const tripoint &max ) : min( min ), max( max ),
+        size_x( max.x - min.x + 1 ), size_y( max.y - min.y + 1 ),
+        dist( size_x * size_y * ( max.z - min.z + 1 ), std::numeric_limits<float>::max() ),
+        closed( dist.size(), false ) {
+    }
+
+    bool inside( const tripoint &p ) const {
+        return p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y &&
+               p.z >= min.z && p.z <= max.z;
+    }
+    /** The point must be @ref inside the grid. */
+    size_t index( const tripoint &p ) const {
+        return ( ( p.z - min.z ) * size_y + ( p.y - min.y ) ) * size_x + ( p.x - min.x );
+    }
+    bool is_closed( const tripoint &p ) const {
+        return inside( p ) && closed[index( p )];
+    }
+};
+
+} // namespace
+
 void game::do_blast( const tripoint &p, const float power,
                      const float distance_factor, const bool fire )
 {
@@ -80,86 +119,113 @@ void game::do_blast( const tripoint &p, const float power,
 
     m.bash( p, fire ? power : ( 2 * power ), true, false, false );
 
-    std::priority_queue< std::pair<float, tripoint>, std::vector< std::pair<float, tripoint> >, pair_greater_cmp >
-    open;
-    std::set<tripoint> closed;
-    std::map<tripoint, float> dist_map;
-    open.push( std::make_pair( 0.0f, p ) );
-    dist_map[p] = 0.0f;
+    // Only tiles closer than this propagate the blast, as the force falls to 1 there.
+    // Each step costs at least one tile (three between z-levels), so everything the blast
+    // touches is within one more tile of that.
+    int reach = MAPSIZE * SEEX;
+    if( power <= 1.0f || distance_factor <= 0.0f ) {
+        reach = 1;
+    } else if( distance_factor < 1.0f ) {
+        reach = std::min<float>( reach, std::log( power ) / -std::log( distance_factor ) + 1.0f );
+    }
+    const int z_reach = m.has_zlevels() ? reach / 3 + 1 : 0;
+    const tripoint grid_min( p.x - reach, p.y - reach, std::max( p.z - z_reach, -OVERMAP_DEPTH ) );
+    const tripoint grid_max( p.x + reach, p.y + reach, std::min( p.z + z_reach, OVERMAP_HEIGHT ) );
+    blast_grid grid( grid_min, grid_max );
+
+    // Bucket queue, the blast spreads to the tiles in one bucket before the next.
+    // Tiles are put into the bucket of the whole part of their distance, which only ever
+    // grows by at least a tile for each step, so no tile is added to the current bucket.
+    std::vector<std::vector<tripoint>> open( 1, std::vector<tripoint>( 1, p ) );
+    std::vector<tripoint> closed;
+    grid.dist[grid.index( p )] = 0.0f;
     // Find all points to blast
-    while( !open.empty() ) {
-        // Add some random factor to effective distance to make it look cooler
-        const float distance = open.top().first * rng_float( 1.0f, 1.2f );
-        const tripoint pt = open.top().second;
-        open.pop();
-
-        if( closed.count( pt ) != 0 ) {
-            continue;
-        }
-
-        closed.insert( pt );
-
-        const float force = power * std::pow( distance_factor, distance );
-        if( force <= 1.0f ) {
-            continue;
-        }
+    for( size_t bucket = 0; bucket < open.size(); bucket++ ) {
+        for( size_t i_open = 0; i_open < open[bucket].size(); i_open++ ) {
+            const tripoint pt = open[bucket][i_open];
+            const size_t pt_index = grid.index( pt );
+            if( grid.closed[pt_index] ) {
+                continue;
+            }
 
-        if( m.impassable( pt ) && pt != p ) {
-            // Don't propagate further
-            continue;
-        }
+            grid.closed[pt_index] = true;
+            closed.push_back( pt );
 
-        // Those will be used for making "shaped charges"
-        // Don't check up/down (for now) - this will make 2D/3D balancing easier
-        int empty_neighbors = 0;
-        for( size_t i = 0; i < 8; i++ ) {
-            tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
-            if( closed.count( dest ) == 0 && m.valid_move( pt, dest, false, true ) ) {
-                empty_neighbors++;
+            // Add some random factor to effective distance to make it look cooler
+            const float distance = grid.dist[pt_index] * rng_float( 1.0f, 1.2f );
+            const float force = power * std::pow( distance_factor, distance );
+            if( force <= 1.0f ) {
+                continue;
             }
-        }
 
-        empty_neighbors = std::max( 1, empty_neighbors );
-        // Iterate over all neighbors. Bash all of them, propagate to some
-        for( size_t i = 0; i < max_index; i++ ) {
-            tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
-            if( closed.count( dest ) != 0 ) {
+            if( m.impassable( pt ) && pt != p ) {
+                // Don't propagate further
                 continue;
             }
 
-            // Up to 200% bonus for shaped charge
-            // But not if the explosion is fiery, then only half the force and no bonus
-            const float bash_force = !fire ?
-                                     force + ( 2 * force / empty_neighbors ) :
-                                     force / 2;
-            if( z_offset[i] == 0 ) {
-                // Horizontal - no floor bashing
-                m.bash( dest, bash_force, true, false, false );
-            } else if( z_offset[i] > 0 ) {
-                // Should actually bash through the floor first, but that's not really possible yet
-                m.bash( dest, bash_force, true, false, true );
-            } else if( !m.valid_move( pt, dest, false, true ) ) {
-                // Only bash through floor if it doesn't exist
-                // Bash the current tile's floor, not the one's below
-                m.bash( pt, bash_force, true, false, true );
+            // Those will be used for making "shaped charges"
+            // Don't check up/down (for now) - this will make 2D/3D balancing easier
+            int empty_neighbors = 0;
+            for( size_t i = 0; i < 8; i++ ) {
+                tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
+                if( !grid.is_closed( dest ) && m.valid_move( pt, dest, false, true ) ) {
+                    empty_neighbors++;
+                }
             }
 
-            float next_dist = distance;
-            next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
-            if( z_offset[i] != 0 ) {
-                if( !m.valid_move( pt, dest, false, true ) ) {
+            empty_neighbors = std::max( 1, empty_neighbors );
+            // Iterate over all neighbors. Bash all of them, propagate to some
+            for( size_t i = 0; i < max_index; i++ ) {
+                tripoint dest( pt.x + x_offset[i], pt.y + y_offset[i], pt.z + z_offset[i] );
+                if( grid.is_closed( dest ) ) {
                     continue;
                 }
 
-                next_dist += zlev_dist;
-            }
+                // Up to 200% bonus for shaped charge
+                // But not if the explosion is fiery, then only half the force and no bonus
+                const float bash_force = !fire ?
+                                         force + ( 2 * force / empty_neighbors ) :
+                                         force / 2;
+                if( z_offset[i] == 0 ) {
+                    // Horizontal - no floor bashing
+                    m.bash( dest, bash_force, true, false, false );
+                } else if( z_offset[i] > 0 ) {
+                    // Should actually bash through the floor first, but that's not really possible yet
+                    m.bash( dest, bash_force, true, false, true );
+                } else if( !m.valid_move( pt, dest, false, true ) ) {
+                    // Only bash through floor if it doesn't exist
+                    // Bash the current tile's floor, not the one's below
+                    m.bash( pt, bash_force, true, false, true );
+                }
+
+                float next_dist = distance;
+                next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
+                if( z_offset[i] != 0 ) {
+                    if( !m.valid_move( pt, dest, false, true ) ) {
+                        continue;
+                    }
+
+                    next_dist += zlev_dist;
+                }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
-                open.push( std::make_pair( next_dist, dest ) );
-                dist_map[dest] = next_dist;
+                // Tiles out of the grid are out of reach or outside of the z-levels
+                if( !grid.inside( dest ) ) {
+                    continue;
+                }
+                float &dest_dist = grid.dist[grid.index( dest )];
+                if( dest_dist > next_dist ) {
+                    dest_dist = next_dist;
+                    const size_t dest_bucket = next_dist;
+                    if( dest_bucket >= open.size() ) {
+                        open.resize( dest_bucket + 1 );
+                    }
+                    open[dest_bucket].push_back( dest );
+                }
             }
         }
     }
+    // Handle the tiles in a fixed order, not the random one they were reached in
+    std::sort( closed.begin(), closed.end() );
 
     // Draw the explosion
     std::map<tripoint, nc_color> explosion_colors;
@@ -168,7 +234,7 @@ void game::do_blast( const tripoint &p, const float power,
             continue;
         }
 
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, grid.dist[grid.index( pt )] );
         nc_color col = c_red;
         if( force < 10 ) {
             col = c_white;
@@ -182,7 +248,7 @@ void game::do_blast( const tripoint &p, const float power,
     draw_custom_explosion( u.pos(), explosion_colors );
 
     for( const tripoint &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, grid.dist[grid.index( pt )] );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -332,7 +398,7 @@ std::unordered_map<tripoint, std::pair<int, int>> game::explosion( const tripoin
 
             // Truncate to a random selection
             int qty = shr.count * std::min( shr.recovery, 100 ) / 100;
-            std::random_shuffle( tiles.begin(), tiles.end() );
+            rng_shuffle( tiles.begin(), tiles.end() );
             tiles.resize( std::min( int( tiles.size() ), qty ) );
 
             for( const auto &e : tiles ) {
@@ -360,7 +426,9 @@ std::unordered_map<tripoint, int> game::shrapnel( const tripoint &src, int power
     proj.proj_effects.insert( "NULL_SOURCE" );
     proj.proj_effects.insert( "WIDE" ); // suppress MF_HARDTOSHOOT
 
-    auto func = [this, &distrib, &mass, &proj]( const tripoint & e, int &kinetic ) {
+    // Set by func when the hit may have changed more than the tile it was on
+    bool area_changed = false;
+    auto func = [this, &distrib, &mass, &proj, &area_changed]( const tripoint & e, int &kinetic ) {
         distrib[ e ] += 0; // add this tile to the distribution
 
         auto critter = critter_at( e );
@@ -373,6 +441,8 @@ std::unordered_map<tripoint, int> game::shrapnel( const tripoint &src, int power
             distrib[ e ] += kinetic; // increase received damage for tile in distribution
 
             critter->deal_projectile_attack( nullptr, frag );
+            // Dying creatures may explode or leave others behind
+            area_changed = critter->is_dead_state();
             return false;
         }
 
@@ -382,11 +452,22 @@ std::unordered_map<tripoint, int> game::shrapnel( const tripoint &src, int power
             int resistance;
 
             if( optional_vpart_position vp = m.veh_at( e ) ) {
+                const vehicle_part &part = vp->vehicle().parts[ vp->part_index() ];
+                const bool tank = part.is_tank();
+                const bool was_broken = part.is_broken();
                 resistance = force - vp->vehicle().damage( vp->part_index(), force );
+                // Damaged tanks may explode, broken parts may take others with them
+                const optional_vpart_position now = m.veh_at( e );
+                area_changed = tank || !now ||
+                               ( !was_broken && now->vehicle().parts[ now->part_index() ].is_broken() );
 
             } else {
+                const ter_id old_ter = m.ter( e );
+                const furn_id old_furn = m.furn( e );
                 resistance = std::max( m.bash_resistance( e ), 0 );
                 m.bash( e, force, true );
+                // Destroyed terrain may collapse or explode
+                area_changed = m.ter( e ) != old_ter || m.furn( e ) != old_furn;
             }
 
             if( m.passable( e ) ) {
@@ -402,18 +483,54 @@ std::unordered_map<tripoint, int> game::shrapnel( const tripoint &src, int power
         return kinetic > 0;
     };
 
+    // special case critter at epicenter to have equivalent chance to adjacent tile
+    std::vector<bool> hits_epicenter;
+    // shrapnel otherwise expands randomly in all directions
+    ray_batch rays( src, range );
+    for( auto i = 0; i != count; ++i ) {
+        hits_epicenter.push_back( one_in( 8 ) );
+        rays.add_ray( random_perimeter( src, range ) );
+    }
+    rays.trace();
+    const auto update_rays = [&rays, &area_changed]( const tripoint & e ) {
+        if( area_changed ) {
+            rays.rebuild();
+            area_changed = false;
+        } else {
+            rays.refresh( e );
+        }
+    };
+
     for( auto i = 0; i != count; ++i ) {
         int kinetic = power;
 
-        // special case critter at epicenter to have equivalent chance to adjacent tile
-        if( one_in( 8 ) && !func( src, kinetic ) ) {
-            continue;
+        if( hits_epicenter[i] ) {
+            const bool goes_on = func( src, kinetic );
+            update_rays( src );
+            if( !goes_on ) {
+                continue;
+            }
         }
 
-        // shrapnel otherwise expands randomly in all directions
-        bresenham( src, random_perimeter( src, range ), 0, 0, [&func, &kinetic]( const tripoint & e ) {
-            return func( e, kinetic );
-        } );
+        const size_t length = rays.length( i );
+        for( size_t step = 0; step < length; step++ ) {
+            // Tiles with nothing in the way only need to be added to the distribution,
+            // unless there is no force left
+            const size_t hit = kinetic > 0 ? rays.next_hit( i, step ) : step;
+            for( ; step < hit; step++ ) {
+                distrib[ rays.point_at( i, step ) ] += 0;
+            }
+            if( step == length ) {
+                break;
+            }
+
+            const tripoint e = rays.point_at( i, step );
+            const bool goes_on = func( e, kinetic );
+            update_rays( e );
+            if( !goes_on ) {
+                break;
+            }
+        }
     }
 
     return distrib;
@@ -44,7 +44,27 @@ const efftype_id effect_stunned( "stunned" );
 const efftype_id effect_teargas( "teargas" );
 const efftype_id effect_webbed( "webbed" );
 
+static const trait_id trait_ACIDPROOF( "ACIDPROOF" );
+static const trait_id trait_M_IMMUNE( "M_IMMUNE" );
 static const trait_id trait_M_SKIN2( "M_SKIN2" );
+static const trait_id trait_THRESH_MARLOSS( "THRESH_MARLOSS" );
+static const trait_id trait_THRESH_MYCUS( "THRESH_MYCUS" );
+static const trait_id trait_WEB_WALKER( "WEB_WALKER" );
+
+static const bionic_id bio_heatsink( "bio_heatsink" );
+
+static const material_id mat_cotton( "cotton" );
+static const material_id mat_flesh( "flesh" );
+static const material_id mat_hflesh( "hflesh" );
+static const material_id mat_iflesh( "iflesh" );
+static const material_id mat_kevlar( "kevlar" );
+static const material_id mat_paper( "paper" );
+static const material_id mat_powder( "powder" );
+static const material_id mat_steel( "steel" );
+static const material_id mat_stone( "stone" );
+static const material_id mat_veggy( "veggy" );
+static const material_id mat_wood( "wood" );
+static const material_id mat_wool( "wool" );
 
 #define INBOUNDS(x, y) \
  (x >= 0 && x < SEEX * my_MAPSIZE && y >= 0 && y < SEEY * my_MAPSIZE)
@@ -1690,7 +1710,7 @@ void map::player_in_field( player &u )
         case fd_web: {
             //If we are in a web, can't walk in webs or are in a vehicle, get webbed maybe.
             //Moving through multiple webs stacks the effect.
-            if (!u.has_trait( trait_id( "WEB_WALKER" ) ) && !u.in_vehicle) {
+            if (!u.has_trait( trait_WEB_WALKER ) && !u.in_vehicle) {
                 //between 5 and 15 minus your current web level.
                 u.add_effect( effect_webbed, 1_turns, num_bp, true, cur.getFieldDensity());
                 cur.setFieldDensity( 0 ); //Its spent.
@@ -1711,7 +1731,7 @@ void map::player_in_field( player &u )
                 break;
             }
 
-            if( u.has_trait( trait_id( "ACIDPROOF" ) ) ) {
+            if( u.has_trait( trait_ACIDPROOF ) ) {
                 // No need for warnings
                 break;
             }
@@ -1786,7 +1806,7 @@ void map::player_in_field( player &u )
             break;
 
         case fd_fire:
-            if( u.has_active_bionic( bionic_id( "bio_heatsink" ) ) || u.is_wearing("rm13_armor_on") ||
+            if( u.has_active_bionic( bio_heatsink ) || u.is_wearing("rm13_armor_on") ||
                 u.has_trait( trait_M_SKIN2 ) ) {
                 //heatsink, suit, or internal restructuring prevents ALL fire damage.
                 break;
@@ -1912,7 +1932,7 @@ void map::player_in_field( player &u )
             break;
 
         case fd_fungal_haze:
-            if (!u.has_trait( trait_id( "M_IMMUNE" ) ) && (!inside || (inside && one_in(4))) ) {
+            if (!u.has_trait( trait_M_IMMUNE ) && (!inside || (inside && one_in(4))) ) {
                 u.add_env_effect( effect_fungus, bp_mouth, 4, 10_minutes, num_bp, true );
                 u.add_env_effect( effect_fungus, bp_eyes, 4, 10_minutes, num_bp, true );
             }
@@ -1960,7 +1980,7 @@ void map::player_in_field( player &u )
         case fd_flame_burst:
             //A burst of flame? Only hits the legs and torso.
             if (inside) break; //fireballs can't touch you inside a car.
-            if (!u.has_active_bionic( bionic_id( "bio_heatsink" ) ) && !u.is_wearing("rm13_armor_on") &&
+            if (!u.has_active_bionic( bio_heatsink ) && !u.is_wearing("rm13_armor_on") &&
                 !u.has_trait( trait_M_SKIN2 )) { //heatsink, suit, or Mycus fireproofing stops fire.
                 u.add_msg_player_or_npc(m_bad, _("You're torched by flames!"), _("<npcname> is torched by flames!"));
                 u.deal_damage( nullptr, bp_leg_l, damage_instance( DT_HEAT, rng( 2, 6 ) ) );
@@ -2087,7 +2107,7 @@ void map::player_in_field( player &u )
                 bool inhaled = false;
                 const int density = cur.getFieldDensity();
                 inhaled = u.add_env_effect( effect_poison, bp_mouth, 5, density * 1_minutes );
-                if( u.has_trait( trait_id( "THRESH_MYCUS" ) ) || u.has_trait( trait_id( "THRESH_MARLOSS" ) ) ) {
+                if( u.has_trait( trait_THRESH_MYCUS ) || u.has_trait( trait_THRESH_MARLOSS ) ) {
                     inhaled |= u.add_env_effect( effect_badpoison, bp_mouth, 5, density * 1_minutes );
                     u.hurtall( rng( density, density * 2 ), nullptr );
                     u.add_msg_if_player( m_bad, _("The %s burns your skin."), cur.name().c_str() );
@@ -2175,17 +2195,17 @@ void map::monster_in_field( monster &z )
                 return;
             }
             // TODO: Replace the section below with proper json values
-            if ( z.made_of( material_id( "flesh" ) ) || z.made_of( material_id( "hflesh" ) ) || z.made_of( material_id( "iflesh" ) ) ) {
+            if ( z.made_of( mat_flesh ) || z.made_of( mat_hflesh ) || z.made_of( mat_iflesh ) ) {
                 dam += 3;
             }
-            if (z.made_of( material_id( "veggy" ) )) {
+            if (z.made_of( mat_veggy )) {
                 dam += 12;
             }
-            if (z.made_of( material_id( "paper" ) ) || z.made_of(LIQUID) || z.made_of( material_id( "powder" ) ) ||
-                z.made_of( material_id( "wood" ) )  || z.made_of( material_id( "cotton" ) ) || z.made_of( material_id( "wool" ) )) {
+            if (z.made_of( mat_paper ) || z.made_of(LIQUID) || z.made_of( mat_powder ) ||
+                z.made_of( mat_wood )  || z.made_of( mat_cotton ) || z.made_of( mat_wool )) {
                 dam += 20;
             }
-            if (z.made_of( material_id( "stone" ) ) || z.made_of( material_id( "kevlar" ) ) || z.made_of( material_id( "steel" ) )) {
+            if (z.made_of( mat_stone ) || z.made_of( mat_kevlar ) || z.made_of( mat_steel )) {
                 dam += -20;
             }
             if (z.has_flag(MF_FLIES)) {
@@ -2221,14 +2241,14 @@ void map::monster_in_field( monster &z )
                 if (cur.getFieldDensity() == 3) {
                     z.moves -= rng(10, 20);
                 }
-                if (z.made_of( material_id( "veggy" ) )) { // Plants suffer from smoke even worse
+                if (z.made_of( mat_veggy )) { // Plants suffer from smoke even worse
                     z.moves -= rng(1, cur.getFieldDensity() * 12);
                 }
             }
             break;
 
         case fd_tear_gas:
-            if ((z.made_of( material_id( "flesh" ) ) || z.made_of( material_id( "hflesh" ) ) || z.made_of( material_id( "veggy" ) ) || z.made_of( material_id( "iflesh" ) )) &&
+            if ((z.made_of( mat_flesh ) || z.made_of( mat_hflesh ) || z.made_of( mat_veggy ) || z.made_of( mat_iflesh )) &&
                 !z.has_flag(MF_NO_BREATHE)) {
                 if (cur.getFieldDensity() == 3) {
                     z.add_effect( effect_stunned, rng( 1_minutes, 2_minutes ) );
@@ -2239,7 +2259,7 @@ void map::monster_in_field( monster &z )
                 } else {
                     z.add_effect( effect_stunned, rng( 1_turns, 5_turns ) );
                 }
-                if (z.made_of( material_id( "veggy" ) )) {
+                if (z.made_of( mat_veggy )) {
                     z.moves -= rng(cur.getFieldDensity() * 5, cur.getFieldDensity() * 12);
                     dam += cur.getFieldDensity() * rng(8, 14);
                 }
@@ -2250,7 +2270,7 @@ void map::monster_in_field( monster &z )
             break;
 
         case fd_relax_gas:
-            if ((z.made_of( material_id( "flesh" ) ) || z.made_of( material_id( "hflesh" ) ) || z.made_of( material_id( "veggy" ) ) || z.made_of( material_id( "iflesh" ) )) &&
+            if ((z.made_of( mat_flesh ) || z.made_of( mat_hflesh ) || z.made_of( mat_veggy ) || z.made_of( mat_iflesh )) &&
                 !z.has_flag(MF_NO_BREATHE)) {
                 z.add_effect( effect_stunned, rng( cur.getFieldDensity() * 4_turns, cur.getFieldDensity() * 8_turns ) );
             }
@@ -2282,7 +2302,7 @@ void map::monster_in_field( monster &z )
                     z.moves -= rng(0, 15);
                     dam += rng(0, 12);
                 }
-                if (z.made_of( material_id( "veggy" ) )) {
+                if (z.made_of( mat_veggy )) {
                     z.moves -= rng(cur.getFieldDensity() * 5, cur.getFieldDensity() * 12);
                     dam *= cur.getFieldDensity();
                 }
@@ -2291,17 +2311,17 @@ void map::monster_in_field( monster &z )
 
             // MATERIALS-TODO: Use fire resistance
         case fd_flame_burst:
-            if (z.made_of( material_id( "flesh" ) ) || z.made_of( material_id( "hflesh" ) ) || z.made_of( material_id( "iflesh" ) )) {
+            if (z.made_of( mat_flesh ) || z.made_of( mat_hflesh ) || z.made_of( mat_iflesh )) {
                 dam += 3;
             }
-            if (z.made_of( material_id( "veggy" ) )) {
+            if (z.made_of( mat_veggy )) {
                 dam += 12;
             }
-            if (z.made_of( material_id( "paper" ) ) || z.made_of(LIQUID) || z.made_of( material_id( "powder" ) ) ||
-                z.made_of( material_id( "wood" ) )  || z.made_of( material_id( "cotton" ) ) || z.made_of( material_id( "wool" ) )) {
+            if (z.made_of( mat_paper ) || z.made_of(LIQUID) || z.made_of( mat_powder ) ||
+                z.made_of( mat_wood )  || z.made_of( mat_cotton ) || z.made_of( mat_wool )) {
                 dam += 50;
             }
-            if (z.made_of( material_id( "stone" ) ) || z.made_of( material_id( "kevlar" ) ) || z.made_of( material_id( "steel" ) )) {
+            if (z.made_of( mat_stone ) || z.made_of( mat_kevlar ) || z.made_of( mat_steel )) {
                 dam += -25;
             }
             dam += rng(0, 8);
@@ -2341,17 +2361,17 @@ void map::monster_in_field( monster &z )
 
         case fd_incendiary:
             // MATERIALS-TODO: Use fire resistance
-            if ( z.made_of( material_id( "flesh" ) ) || z.made_of( material_id( "hflesh" ) ) || z.made_of( material_id( "iflesh" ) ) ) {
+            if ( z.made_of( mat_flesh ) || z.made_of( mat_hflesh ) || z.made_of( mat_iflesh ) ) {
                 dam += 3;
             }
-            if (z.made_of( material_id( "veggy" ) )) {
+            if (z.made_of( mat_veggy )) {
                 dam += 12;
             }
-            if (z.made_of( material_id( "paper" ) ) || z.made_of(LIQUID) || z.made_of( material_id( "powder" ) ) ||
-                z.made_of( material_id( "wood" ) )  || z.made_of( material_id( "cotton" ) ) || z.made_of( material_id( "wool" ) )) {
+            if (z.made_of( mat_paper ) || z.made_of(LIQUID) || z.made_of( mat_powder ) ||
+                z.made_of( mat_wood )  || z.made_of( mat_cotton ) || z.made_of( mat_wool )) {
                 dam += 20;
             }
-            if (z.made_of( material_id( "stone" ) ) || z.made_of( material_id( "kevlar" ) ) || z.made_of( material_id( "steel" ) )) {
+            if (z.made_of( mat_stone ) || z.made_of( mat_kevlar ) || z.made_of( mat_steel )) {
                 dam += -5;
             }
 
@@ -2360,15 +2380,15 @@ void map::monster_in_field( monster &z )
             } else if (cur.getFieldDensity() == 2) {
                 dam += rng(6, 12);
                 z.moves -= 20;
-                if (!z.made_of(LIQUID) && !z.made_of( material_id( "stone" ) ) && !z.made_of( material_id( "kevlar" ) ) &&
-                !z.made_of( material_id( "steel" ) ) && !z.has_flag(MF_FIREY)) {
+                if (!z.made_of(LIQUID) && !z.made_of( mat_stone ) && !z.made_of( mat_kevlar ) &&
+                !z.made_of( mat_steel ) && !z.has_flag(MF_FIREY)) {
                     z.add_effect( effect_onfire, rng( 8_turns, 12_turns ) );
                 }
             } else if (cur.getFieldDensity() == 3) {
                 dam += rng(10, 20);
                 z.moves -= 40;
-                if (!z.made_of(LIQUID) && !z.made_of( material_id( "stone" ) ) && !z.made_of( material_id( "kevlar" ) ) &&
-                !z.made_of( material_id( "steel" ) ) && !z.has_flag(MF_FIREY)) {
+                if (!z.made_of(LIQUID) && !z.made_of( mat_stone ) && !z.made_of( mat_kevlar ) &&
+                !z.made_of( mat_steel ) && !z.has_flag(MF_FIREY)) {
                         z.add_effect( effect_onfire, rng( 12_turns, 16_turns ) );
                 }
             }
@@ -5,9 +5,139 @@
 
 #include <map>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
 
 std::map<std::string, json_flag> json_flags_all;
 
+namespace
+{
+
+struct flag_entry {
+    std::string name;
+    /**
+     * Whether the flag is inherited. Set by json_flag::load, flags that are not
+     * defined in JSON are inherited (like the null json_flag says).
+     */
+    std::atomic<bool> inherit{ true };
+};
+
+/**
+ * The entries live in fixed size chunks that are never moved or freed, and a chunk is
+ * allocated before any id pointing into it is handed out. So @ref flag_id::str and
+ * @ref flag_id::inherit read them without the lock, only interning needs it.
+ */
+struct flag_table {
+    static constexpr size_t chunk_size = 256;
+    static constexpr size_t max_chunks = 256;
+
+    std::mutex mutex;
+    std::unordered_map<std::string, size_t> ids;
+    std::array<std::unique_ptr<std::array<flag_entry, chunk_size>>, max_chunks> chunks;
+    size_t size = 0;
+
+    flag_table() {
+        // index 0 is the null flag
+        add( std::string() ).inherit = false;
+    }
+
+    flag_entry &entry( size_t index ) {
+        return ( *chunks[index / chunk_size] )[index % chunk_size];
+    }
+
+    /** Requires the lock (or being the constructor). */
+    flag_entry &add( const std::string &name ) {
+        if( size % chunk_size == 0 ) {
+            if( size / chunk_size >= max_chunks ) {
+                throw std::runtime_error( "too many distinct flags, can not intern " + name );
+            }
+            chunks[size / chunk_size].reset( new std::array<flag_entry, chunk_size>() );
+        }
+        flag_entry &result = entry( size++ );
+        result.name = name;
+        return result;
+    }
+};
+
+// Function local so flag_id objects with static storage can be constructed safely,
+// interning doesn't look at the flag definitions, which may not be loaded (or even
+// constructed) yet.
+flag_table &get_flag_table()
+{
+    static flag_table table;
+    return table;
+}
+
+/**
+ * The flags this thread looked up before, so the string has_flag overloads don't need
+ * the lock. Only interned flags are remembered, a string that isn't interned yet may be
+ * later on.
+ */
+std::unordered_map<std::string, size_t> &known_flags()
+{
+    static thread_local std::unordered_map<std::string, size_t> known;
+    return known;
+}
+
+} // namespace
+
+flag_id::flag_id( const std::string &id )
+{
+    if( id.empty() ) {
+        return;
+    }
+    auto &known = known_flags();
+    const auto cached = known.find( id );
+    if( cached != known.end() ) {
+        index = cached->second;
+        return;
+    }
+    flag_table &table = get_flag_table();
+    {
+        std::lock_guard<std::mutex> lock( table.mutex );
+        const auto iter = table.ids.find( id );
+        if( iter != table.ids.end() ) {
+            index = iter->second;
+        } else {
+            index = table.size;
+            table.add( id );
+            table.ids.emplace( id, index );
+        }
+    }
+    known.emplace( id, index );
+}
+
+flag_id flag_id::find( const std::string &id )
+{
+    auto &known = known_flags();
+    const auto cached = known.find( id );
+    if( cached != known.end() ) {
+        return flag_id( cached->second );
+    }
+    flag_table &table = get_flag_table();
+    std::lock_guard<std::mutex> lock( table.mutex );
+    const auto iter = table.ids.find( id );
+    if( iter == table.ids.end() ) {
+        return flag_id();
+    }
+    known.emplace( id, iter->second );
+    return flag_id( iter->second );
+}
+
+const std::string &flag_id::str() const
+{
+    return get_flag_table().entry( index ).name;
+}
+
+bool flag_id::inherit() const
+{
+    return get_flag_table().entry( index ).inherit.load( std::memory_order_relaxed );
+}
+
 const json_flag &json_flag::get( const std::string &id )
 {
     static json_flag null_flag;
@@ -23,6 +153,9 @@ void json_flag::load( JsonObject &jo )
     jo.read( "info", f.info_ );
     jo.read( "conflicts", f.conflicts_ );
     jo.read( "inherit", f.inherit_ );
+
+    const flag_id fid( id );
+    get_flag_table().entry( fid.index ).inherit.store( f.inherit_, std::memory_order_relaxed );
 }
 
 void json_flag::check_consistency()
@@ -44,4 +177,84 @@ void json_flag::check_consistency()
 void json_flag::reset()
 {
     json_flags_all.clear();
+    flag_table &table = get_flag_table();
+    std::lock_guard<std::mutex> lock( table.mutex );
+    for( size_t i = 1; i < table.size; i++ ) {
+        table.entry( i ).inherit.store( true, std::memory_order_relaxed );
+    }
+}
+
+flag_set::flag_set( const container &flags )
+{
+    *this = flags;
+}
+
+flag_set &flag_set::operator=( const container &flags )
+{
+    clear();
+    insert( flags.begin(), flags.end() );
+    return *this;
+}
+
+void flag_set::set_bit( const flag_id &flag, bool value )
+{
+    const size_t i = flag.to_i();
+    if( i / 64 >= bits.size() ) {
+        if( !value ) {
+            return;
+        }
+        bits.resize( i / 64 + 1, 0 );
+    }
+    if( value ) {
+        bits[i / 64] |= uint64_t( 1 ) << ( i % 64 );
+    } else {
+        bits[i / 64] &= ~( uint64_t( 1 ) << ( i % 64 ) );
+    }
+}
+
+std::pair<flag_set::iterator, bool> flag_set::insert( const std::string &flag )
+{
+    const auto res = flags.insert( flag );
+    if( res.second ) {
+        set_bit( flag_id( flag ), true );
+    }
+    return res;
+}
+
+flag_set::iterator flag_set::insert( const_iterator, const std::string &flag )
+{
+    return insert( flag ).first;
+}
+
+size_t flag_set::erase( const std::string &flag )
+{
+    if( flags.erase( flag ) == 0 ) {
+        return 0;
+    }
+    set_bit( flag_id::find( flag ), false );
+    return 1;
+}
+
+flag_set::iterator flag_set::erase( const_iterator iter )
+{
+    set_bit( flag_id::find( *iter ), false );
+    return flags.erase( iter );
+}
+
+void flag_set::clear()
+{
+    flags.clear();
+    bits.clear();
+}
+
+void flag_set::serialize( JsonOut &json ) const
+{
+    json.write( flags );
+}
+
+void flag_set::deserialize( JsonIn &jsin )
+{
+    container read_flags;
+    jsin.read( read_flags );
+    *this = read_flags;
 }
@@ -2,10 +2,14 @@
 #ifndef FLAG_H
 #define FLAG_H
 
+#include <cstdint>
 #include <set>
 #include <string>
+#include <vector>
 
 class JsonObject;
+class JsonIn;
+class JsonOut;
 
 class json_flag
 {
@@ -53,4 +57,127 @@ class json_flag
         static void reset();
 };
 
+/**
+ * Interned flag name. Every distinct flag string gets a small integer id the first time
+ * a flag_id is created from it. Ids are never released, so they can be stored in static
+ * variables and stay valid across data reloads. Ids can be created and used on any thread,
+ * only interning a string the thread hasn't seen before takes the table lock.
+ * The default constructed id (and the one returned by @ref find for strings that were
+ * never interned) is the null id, no item or type can have it.
+ */
+class flag_id
+{
+    public:
+        flag_id() = default;
+        /** Interns the string, this may add it to the table. */
+        explicit flag_id( const std::string &id );
+
+        /** Returns the id of an already interned flag, or the null id. Never adds to the table. */
+        static flag_id find( const std::string &id );
+
+        const std::string &str() const;
+        /** Same as `json_flag::get( str() ).inherit()`, but without the lookup. */
+        bool inherit() const;
+
+        bool is_null() const {
+            return index == 0;
+        }
+        size_t to_i() const {
+            return index;
+        }
+
+        bool operator==( const flag_id &rhs ) const {
+            return index == rhs.index;
+        }
+        bool operator!=( const flag_id &rhs ) const {
+            return index != rhs.index;
+        }
+
+    private:
+        friend class json_flag;
+
+        explicit flag_id( size_t index ) : index( index ) {}
+
+        size_t index = 0;
+};
+
+/**
+ * A set of flag names, used for the flags of items and item types.
+ * It behaves like a (read only iterable) `std::set<std::string>`, but also keeps a bitset
+ * of the interned ids of its members, so @ref has is a single bit test.
+ */
+class flag_set
+{
+    public:
+        using container = std::set<std::string>;
+        using value_type = container::value_type;
+        using iterator = container::const_iterator;
+        using const_iterator = container::const_iterator;
+
+        flag_set() = default;
+        flag_set( const container &flags );
+        flag_set &operator=( const container &flags );
+
+        bool has( const flag_id &flag ) const {
+            const size_t i = flag.to_i();
+            return i / 64 < bits.size() && ( ( bits[i / 64] >> ( i % 64 ) ) & 1 );
+        }
+
+        size_t count( const std::string &flag ) const {
+            return has( flag_id::find( flag ) ) ? 1 : 0;
+        }
+        const_iterator find( const std::string &flag ) const {
+            return has( flag_id::find( flag ) ) ? flags.find( flag ) : flags.end();
+        }
+
+        std::pair<iterator, bool> insert( const std::string &flag );
+        /** For use with `std::inserter`, the hint is ignored. */
+        iterator insert( const_iterator hint, const std::string &flag );
+        template<typename It>
+        void insert( It first, It last ) {
+            for( ; first != last; ++first ) {
+                insert( *first );
+            }
+        }
+        size_t erase( const std::string &flag );
+        iterator erase( const_iterator iter );
+        void clear();
+
+        const_iterator begin() const {
+            return flags.begin();
+        }
+        const_iterator end() const {
+            return flags.end();
+        }
+        bool empty() const {
+            return flags.empty();
+        }
+        size_t size() const {
+            return flags.size();
+        }
+
+        const container &as_set() const {
+            return flags;
+        }
+        operator const container &() const {
+            return flags;
+        }
+
+        bool operator==( const flag_set &rhs ) const {
+            return flags == rhs.flags;
+        }
+        bool operator!=( const flag_set &rhs ) const {
+            return flags != rhs.flags;
+        }
+
+        void serialize( JsonOut &json ) const;
+        void deserialize( JsonIn &jsin );
+
+    private:
+        void set_bit( const flag_id &flag, bool value );
+
+        container flags;
+        std::vector<uint64_t> bits;
+};
+
 #endif
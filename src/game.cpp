@@ -105,10 +105,13 @@
 #include "monexamine.h"
 #include "loading_ui.h"
 #include "sidebar.h"
+#include "thread_pool.h"
+#include "world_snapshot.h"
 
 #include <map>
 #include <set>
 #include <algorithm>
+#include <array>
 #include <string>
 #include <sstream>
 #include <cmath>
@@ -202,6 +205,28 @@ static const trait_id trait_SHELL2( "SHELL2" );
 static const trait_id trait_VINES2( "VINES2" );
 static const trait_id trait_VINES3( "VINES3" );
 
+// Options that are read every turn or every redraw
+static const option_handle<bool> option_animations( "ANIMATIONS" );
+static const option_handle<bool> option_animation_rain( "ANIMATION_RAIN" );
+static const option_handle<bool> option_animation_sct( "ANIMATION_SCT" );
+static const option_handle<bool> option_auto_pickup( "AUTO_PICKUP" );
+static const option_handle<bool> option_auto_pickup_adjacent( "AUTO_PICKUP_ADJACENT" );
+static const option_handle<bool> option_auto_pickup_safemode( "AUTO_PICKUP_SAFEMODE" );
+static const option_handle<bool> option_auto_pulp_butcher( "AUTO_PULP_BUTCHER" );
+static const option_handle<bool> option_autosafemode( "AUTOSAFEMODE" );
+static const option_handle<int> option_autosafemode_turns( "AUTOSAFEMODETURNS" );
+static const option_handle<bool> option_autosave( "AUTOSAVE" );
+static const option_handle<int> option_autosave_turns( "AUTOSAVE_TURNS" );
+static const option_handle<bool> option_driving_view_offset( "DRIVING_VIEW_OFFSET" );
+static const option_handle<bool> option_force_redraw( "FORCE_REDRAW" );
+static const option_handle<bool> option_load_map_ahead( "LOAD_MAP_AHEAD" );
+static const option_handle<bool> option_parallel_monster_planning( "PARALLEL_MONSTER_PLANNING" );
+static const option_handle<bool> option_parallel_npc_planning( "PARALLEL_NPC_PLANNING" );
+static const option_handle<bool> option_pregenerate_overmaps( "PREGENERATE_OVERMAPS" );
+static const option_handle<int> option_move_view_offset( "MOVE_VIEW_OFFSET" );
+static const option_handle<int> option_safemode_proximity( "SAFEMODEPROXIMITY" );
+static const option_handle<bool> option_vehicle_dir_indicator( "VEHICLE_DIR_INDICATOR" );
+
 void advanced_inv(); // player_activity.cpp
 void intro();
 
@@ -800,7 +825,7 @@ bool game::start_game()
         gamemode.reset( new special_game() );
     }
 
-    seed = rand();
+    seed = rng_draw_seed();
     new_game = true;
     start_calendar();
     nextweather = calendar::turn;
@@ -1299,7 +1324,7 @@ static int veh_lumi( vehicle &veh )
 
 void game::calc_driving_offset(vehicle *veh)
 {
-    if (veh == nullptr || !get_option<bool>( "DRIVING_VIEW_OFFSET" ) ) {
+    if (veh == nullptr || !option_driving_view_offset.value() ) {
         set_driving_view_offset(point(0, 0));
         return;
     }
@@ -1438,8 +1463,8 @@ bool game::do_turn()
     u.update_body();
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( option_autosave.value() &&
+        calendar::once_every( 1_turns * option_autosave_turns.value() ) &&
         !u.is_dead_state()) {
         autosave();
     }
@@ -1510,6 +1535,7 @@ bool game::do_turn()
 
     m.process_falling();
     m.vehmove();
+    load_map_ahead();
 
     // Process power and fuel consumption for all vehicles, including off-map ones.
     // m.vehmove used to do this, but now it only give them moves instead.
@@ -1538,7 +1564,7 @@ bool game::do_turn()
     monmove();
     update_stair_monsters();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && option_force_redraw.value() ) {
         draw();
         refresh_display();
     }
@@ -2170,7 +2196,7 @@ input_context game::get_player_input(std::string &action)
 
     user_turn current_turn;
 
-    if (get_option<bool>( "ANIMATIONS" ) ) {
+    if (option_animations.value() ) {
         int iStartX = (TERRAIN_WINDOW_WIDTH > 121) ? (TERRAIN_WINDOW_WIDTH - 121) / 2 : 0;
         int iStartY = (TERRAIN_WINDOW_HEIGHT > 121) ? (TERRAIN_WINDOW_HEIGHT - 121) / 2 : 0;
         int iEndX = (TERRAIN_WINDOW_WIDTH > 121) ? TERRAIN_WINDOW_WIDTH - (TERRAIN_WINDOW_WIDTH - 121) / 2 :
@@ -2222,7 +2248,7 @@ input_context game::get_player_input(std::string &action)
                 break;
             }
 
-            if( bWeatherEffect && get_option<bool>( "ANIMATION_RAIN" ) ) {
+            if( bWeatherEffect && option_animation_rain.value() ) {
                 /*
                 Location to add rain drop animation bits! Since it refreshes w_terrain it can be added to the animation section easily
                 Get tile information from above's weather information:
@@ -2268,7 +2294,7 @@ input_context game::get_player_input(std::string &action)
                 }
             }
             // don't bother calculating SCT if we won't show it
-            if (uquit != QUIT_WATCH && get_option<bool>( "ANIMATION_SCT" ) ) {
+            if (uquit != QUIT_WATCH && option_animation_sct.value() ) {
 #ifdef TILES
                 if (!use_tiles) {
 #endif
@@ -2556,7 +2582,7 @@ bool game::handle_action()
     // This has no action unless we're in a special game mode.
     gamemode->pre_action(act);
 
-    int soffset = get_option<int>( "MOVE_VIEW_OFFSET" );
+    int soffset = option_move_view_offset.value();
     int soffsetr = 0 - soffset;
 
     int before_action_moves = u.moves;
@@ -4671,8 +4697,8 @@ void game::draw_sidebar()
     catacurses::window day_window = sideStyle ? w_status2 : w_status;
     mvwprintz(day_window, 0, sideStyle ? 0 : 41, c_white, _("%s, day %d"),
               calendar::name_season( season_of_year( calendar::turn ) ), day_of_season<int>( calendar::turn ) + 1 );
-    if( safe_mode != SAFE_MODE_OFF || get_option<bool>( "AUTOSAFEMODE" ) ) {
-        int iPercent = turnssincelastmon * 100 / get_option<int>( "AUTOSAFEMODETURNS" );
+    if( safe_mode != SAFE_MODE_OFF || option_autosafemode.value() ) {
+        int iPercent = turnssincelastmon * 100 / option_autosafemode_turns.value();
         wmove(w_status, sideStyle ? 4 : 1, getmaxx(w_status) - 4);
         const std::array<std::string, 4> letters = {{ "S", "A", "F", "E" }};
         for (int i = 0; i < 4; i++) {
@@ -4820,7 +4846,7 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
 
 tripoint game::get_veh_dir_indicator_location( bool next ) const
 {
-    if( !get_option<bool>( "VEHICLE_DIR_INDICATOR" ) ) {
+    if( !option_vehicle_dir_indicator.value() ) {
         return tripoint_min;
     }
     const optional_vpart_position vp = m.veh_at( u.pos() );
@@ -5121,7 +5147,7 @@ int game::assign_npc_id()
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    int distance = (option_safemode_proximity.value() <= 0) ? MAX_VIEW_DISTANCE : option_safemode_proximity.value();
     return is_hostile_within(distance);
 }
 
@@ -5167,7 +5193,7 @@ int game::mon_info( const catacurses::window &w )
     const int startrow = use_narrow_sidebar() ? 1 : 0;
 
     int newseen = 0;
-    const int iProxyDist = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    const int iProxyDist = (option_safemode_proximity.value() <= 0) ? MAX_VIEW_DISTANCE : option_safemode_proximity.value();
     // 7 0 1    unique_types uses these indices;
     // 6 8 2    0-7 are provide by direction_from()
     // 5 4 3    8 is used for local monsters (for when we explain them below)
@@ -5320,9 +5346,9 @@ int game::mon_info( const catacurses::window &w )
         if (safe_mode == SAFE_MODE_ON) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if ( get_option<bool>( "AUTOSAFEMODE" ) && newseen == 0 ) { // Auto-safe mode
+    } else if ( option_autosafemode.value() && newseen == 0 ) { // Auto-safe mode
         turnssincelastmon++;
-        if (turnssincelastmon >= get_option<int>( "AUTOSAFEMODETURNS" ) && safe_mode == SAFE_MODE_OFF) {
+        if (turnssincelastmon >= option_autosafemode_turns.value() && safe_mode == SAFE_MODE_OFF) {
             set_safe_mode( SAFE_MODE_ON );
         }
     }
@@ -5499,24 +5525,57 @@ void game::monmove()
     // Make sure these don't match the first time around.
     tripoint cached_lev = m.get_abs_sub() + tripoint( 1, 0, 0 );
 
+    // Planning in parallel plans from a snapshot, taken below, the serial planning looks at
+    // the live creatures and only needs their factions.
+    const bool parallel_planning = option_parallel_monster_planning.value();
+    std::unique_ptr<world_snapshot> world;
+    // The first plans of the monsters, made at the same time from the snapshot.
+    std::vector<cata::optional<monster_intent>> intents;
+    size_t critter_index = 0;
     mfactions monster_factions;
     const auto &playerfaction = mfaction_str_id( "player" );
     for( monster &critter : all_monsters() ) {
         // The first time through, and any time the map has been shifted,
-        // recalculate monster factions.
+        // recalculate monster factions (or take a new snapshot).
         if( cached_lev != m.get_abs_sub() ) {
-            // monster::plan() needs to know about all monsters on the same team as the monster.
-            monster_factions.clear();
-            for( monster &critter : all_monsters() ) {
-                if( critter.friendly == 0 ) {
-                    // Only 1 faction per mon at the moment.
-                    monster_factions[ critter.faction ].insert( &critter );
-                } else {
-                    monster_factions[ playerfaction ].insert( &critter );
+            if( parallel_planning ) {
+                world.reset( new world_snapshot() );
+                critter_index = 0;
+                intents.clear();
+                intents.resize( world->monsters.size() );
+                parallel_for_seeded( 0, static_cast<int>( intents.size() ), [&]( const int i ) {
+                    const monster &planner = static_cast<const monster &>( *world->monsters[i].who );
+                    if( !planner.is_dead() && planner.moves > 0 &&
+                        !planner.has_effect( effect_controlled ) ) {
+                        intents[i] = planner.plan_intent( *world );
+                    }
+                } );
+            } else {
+                // monster::plan() needs to know about all monsters on the same team as the monster.
+                monster_factions.clear();
+                for( monster &critter : all_monsters() ) {
+                    if( critter.friendly == 0 ) {
+                        // Only 1 faction per mon at the moment.
+                        monster_factions[ critter.faction ].insert( &critter );
+                    } else {
+                        monster_factions[ playerfaction ].insert( &critter );
+                    }
                 }
             }
             cached_lev = m.get_abs_sub();
         }
+        cata::optional<monster_intent> intent;
+        if( critter_index < intents.size() ) {
+            // Monsters spawned during the turn have no plan, skip them without losing our place
+            size_t found_index = critter_index;
+            while( found_index < intents.size() && world->monsters[found_index].who != &critter ) {
+                found_index++;
+            }
+            if( found_index < intents.size() ) {
+                critter_index = found_index;
+                intent = std::move( intents[critter_index] );
+            }
+        }
 
         // Critters in impassable tiles get pushed away, unless it's not impassable for them
         if( !critter.is_dead() && m.impassable( critter.pos() ) && !critter.can_move_to( critter.pos() ) ) {
@@ -5551,12 +5610,24 @@ void game::monmove()
             // Controlled critters don't make their own plans
             if (!critter.has_effect( effect_controlled)) {
                 // Formulate a path to follow
-                critter.plan( monster_factions );
+                if( intent ) {
+                    critter.apply_intent( *intent );
+                    intent.reset();
+                } else if( world ) {
+                    critter.apply_intent( critter.plan_intent( *world ) );
+                } else {
+                    critter.plan( monster_factions );
+                }
             }
             critter.move(); // Move one square, possibly hit u
             critter.process_triggers();
             m.creature_in_field( critter );
         }
+        if( world ) {
+            // The monsters planning after this one see where it went and what it did to the player
+            world->update( critter );
+            world->update( u );
+        }
 
         if (!critter.is_dead() &&
             u.has_active_bionic( bionic_id( "bio_alarm" ) ) &&
@@ -5587,13 +5658,36 @@ void game::monmove()
     }
 
     // Now, do active NPCs.
+    std::vector<npc *> npcs;
     for( npc &guy : g->all_npcs() ) {
+        npcs.push_back( &guy );
+    }
+    // The npcs look around and pick their targets at the same time, then act one after
+    // the other. The ai code writes debug messages, which can't be done from several
+    // threads, so it all happens in the loop below in debug mode.
+    std::vector<char> planned( npcs.size(), false );
+    if( option_parallel_npc_planning.value() && !debug_mode ) {
+        parallel_for_seeded( 0, static_cast<int>( npcs.size() ), [&]( const int i ) {
+            npc &guy = *npcs[i];
+            if( !guy.is_dead() && !guy.in_sleep_state() && guy.moves > 0 ) {
+                guy.regen_ai_cache();
+                planned[i] = true;
+            }
+        } );
+    }
+    for( size_t i = 0; i < npcs.size(); i++ ) {
+        npc &guy = *npcs[i];
         int turns = 0;
         m.creature_in_field( guy );
         guy.process_turn();
         while( !guy.is_dead() && !guy.in_sleep_state() && guy.moves > 0 && turns < 10 ) {
             int moves = guy.moves;
-            guy.move();
+            if( planned[i] ) {
+                guy.move_with_ai_cache();
+                planned[i] = false;
+            } else {
+                guy.move();
+            }
             if( moves == guy.moves ) {
                 // Count every time we exit npc::move() without spending any moves.
                 turns++;
@@ -8036,7 +8130,7 @@ tripoint game::look_around( catacurses::window w_info, const tripoint &start_poi
     draw_pixel_minimap();
     u.setpos(current_pos);
 
-    int soffset = get_option<int>( "MOVE_VIEW_OFFSET" );
+    int soffset = option_move_view_offset.value();
     bool fast_scroll = false;
     bool blink = false;
 
@@ -11405,7 +11499,7 @@ void game::place_player( const tripoint &dest_loc )
     // and dest_loc was not adjusted and therefore is still in the un-shifted system and probably wrong.
 
     //Auto pulp or butcher
-    if( get_option<bool>( "AUTO_PULP_BUTCHER" ) && mostseen == 0 ) {
+    if( option_auto_pulp_butcher.value() && mostseen == 0 ) {
         const std::string pulp_butcher = get_option<std::string>( "AUTO_PULP_BUTCHER_ACTION" );
         if( pulp_butcher == "butcher" && u.max_quality( quality_id( "BUTCHER" ) ) > INT_MIN ) {
             std::vector<int> corpses;
@@ -11448,8 +11542,8 @@ void game::place_player( const tripoint &dest_loc )
     }
 
     //Autopickup
-    if (get_option<bool>( "AUTO_PICKUP" ) && (!get_option<bool>( "AUTO_PICKUP_SAFEMODE" ) || mostseen == 0) &&
-        ( m.has_items( u.pos() ) || get_option<bool>( "AUTO_PICKUP_ADJACENT" ) ) ) {
+    if (option_auto_pickup.value() && (!option_auto_pickup_safemode.value() || mostseen == 0) &&
+        ( m.has_items( u.pos() ) || option_auto_pickup_adjacent.value() ) ) {
         Pickup::pick_up(u.pos(), -1);
     }
 
@@ -11952,7 +12046,7 @@ void game::fling_creature(Creature *c, const int &dir, float flvel, bool control
     int steps = 0;
     const bool is_u = (c == &u);
     // Don't animate critters getting bashed if animations are off
-    const bool animate = is_u || get_option<bool>( "ANIMATIONS" );
+    const bool animate = is_u || option_animations.value();
 
     player *p = dynamic_cast<player*>(c);
 
@@ -12579,6 +12673,7 @@ void game::update_map(int &x, int &y)
 
     // this handles loading/unloading submaps that have scrolled on or off the viewport
     m.shift( shiftx, shifty );
+    last_map_shift = point( shiftx, shifty );
 
     // Shift monsters
     shift_monsters( shiftx, shifty, 0 );
@@ -12615,6 +12710,37 @@ void game::update_map(int &x, int &y)
 
     // Update what parts of the world map we can see
     update_overmap_seen();
+
+    if( option_pregenerate_overmaps.value() ) {
+        overmap_buffer.process_pregeneration( u.global_omt_location() );
+    }
+}
+
+void game::load_map_ahead()
+{
+    if( !option_load_map_ahead.value() ) {
+        return;
+    }
+    // Walking shifts the map every dozen turns at most, preparing one quad per turn
+    // keeps up with that. Vehicles look further ahead the faster they go.
+    point dir = last_map_shift;
+    int distance = 1;
+    int budget = 1;
+    const vehicle *veh = veh_pointer_or_null( m.veh_at( u.pos() ) );
+    if( veh != nullptr && veh->velocity != 0 ) {
+        static const std::array<point, 8> dir8_offsets = {{
+                point( 1, 0 ), point( 1, 1 ), point( 0, 1 ), point( -1, 1 ),
+                point( -1, 0 ), point( -1, -1 ), point( 0, -1 ), point( 1, -1 )
+            }
+        };
+        dir = dir8_offsets[veh->move.dir8()];
+        if( veh->velocity < 0 ) {
+            dir = point( -dir.x, -dir.y );
+        }
+        distance = std::min( 1 + std::abs( veh->velocity ) / 2000, 3 );
+        budget = 2 * distance;
+    }
+    m.load_ahead( point( sgn( dir.x ), sgn( dir.y ) ), distance, budget );
 }
 
 void game::update_overmap_seen()
@@ -321,6 +321,8 @@ class game
         bool spawn_hallucination();
         /** Swaps positions of two creatures */
         bool swap_critters( Creature &first, Creature &second );
+        /** Processes the turn of all monsters in the reality bubble, letting them act. */
+        void monmove();
 
     private:
         friend class monster_range;
@@ -980,9 +982,9 @@ class game
 
         // Routine loop functions, approximately in order of execution
         void cleanup_dead();     // Delete any dead NPCs/monsters
-        void monmove();          // Monster movement
         void process_activity(); // Processes and enacts the player's activity
         void update_weather();   // Updates the temperature and weather patten
+        void load_map_ahead();   // Prepares the submaps the map will shift onto next
         int  mon_info( const catacurses::window & ); // Prints a list of nearby monsters
         void handle_key_blocking_activity(); // Abort reading etc.
         bool handle_action();
@@ -1044,6 +1046,7 @@ class game
         //  quit_status uquit;    // Set to true if the player quits ('Q')
         bool bVMonsterLookFire;
         time_point nextweather; // The time on which weather will shift next.
+        point last_map_shift; // Direction of the last map shift, used by load_map_ahead
         int next_npc_id, next_mission_id; // Keep track of UIDs
         std::map<mtype_id, int> kills;         // Player's kill count
         std::list<std::string> npc_kills;      // names of NPCs the player killed
@@ -145,6 +145,11 @@ class inventory : public visitable<inventory>
 
         void rust_iron_items();
 
+        /**
+         * Total weight and volume of all items, worked out every time. They are not cached,
+         * items can be changed through item_location and kept references without the
+         * inventory knowing.
+         */
         units::mass weight() const;
         units::volume volume() const;
 
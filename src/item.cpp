@@ -85,8 +85,102 @@ const efftype_id effect_shakes( "shakes" );
 const efftype_id effect_sleep( "sleep" );
 const efftype_id effect_weed_high( "weed_high" );
 
+const material_id mat_bone( "bone" );
+const material_id mat_iron( "iron" );
 const material_id mat_leather( "leather" );
 const material_id mat_kevlar( "kevlar" );
+const material_id mat_steel( "steel" );
+const material_id mat_stone( "stone" );
+const material_id mat_veggy( "veggy" );
+
+static const flag_id flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
+static const flag_id flag_BELTED( "BELTED" );
+static const flag_id flag_BIPOD( "BIPOD" );
+static const flag_id flag_CABLE_SPOOL( "CABLE_SPOOL" );
+static const flag_id flag_CANNIBALISM( "CANNIBALISM" );
+static const flag_id flag_CASING( "CASING" );
+static const flag_id flag_CHARGEDIM( "CHARGEDIM" );
+static const flag_id flag_COLD( "COLD" );
+static const flag_id flag_COLLAPSIBLE_STOCK( "COLLAPSIBLE_STOCK" );
+static const flag_id flag_CONDUCTIVE( "CONDUCTIVE" );
+static const flag_id flag_DANGEROUS( "DANGEROUS" );
+static const flag_id flag_DIAMOND( "DIAMOND" );
+static const flag_id flag_DISABLE_SIGHTS( "DISABLE_SIGHTS" );
+static const flag_id flag_FILTHY( "FILTHY" );
+static const flag_id flag_FIRE_100( "FIRE_100" );
+static const flag_id flag_FIRE_20( "FIRE_20" );
+static const flag_id flag_FIRE_50( "FIRE_50" );
+static const flag_id flag_FIRE_TWOHAND( "FIRE_TWOHAND" );
+static const flag_id flag_FIT( "FIT" );
+static const flag_id flag_HELMET_COMPAT( "HELMET_COMPAT" );
+static const flag_id flag_HIDDEN_HALLU( "HIDDEN_HALLU" );
+static const flag_id flag_HIDDEN_POISON( "HIDDEN_POISON" );
+static const flag_id flag_HOT( "HOT" );
+static const flag_id flag_IRREMOVABLE( "IRREMOVABLE" );
+static const flag_id flag_IS_ARMOR( "IS_ARMOR" );
+static const flag_id flag_LEAK_ALWAYS( "LEAK_ALWAYS" );
+static const flag_id flag_LEAK_DAM( "LEAK_DAM" );
+static const flag_id flag_LITCIG( "LITCIG" );
+static const flag_id flag_MAG_BELT( "MAG_BELT" );
+static const flag_id flag_MAG_DESTROY( "MAG_DESTROY" );
+static const flag_id flag_MAG_EJECT( "MAG_EJECT" );
+static const flag_id flag_NEEDS_UNFOLD( "NEEDS_UNFOLD" );
+static const flag_id flag_NEVER_JAMS( "NEVER_JAMS" );
+static const flag_id flag_NONCONDUCTIVE( "NONCONDUCTIVE" );
+static const flag_id flag_NO_DROP( "NO_DROP" );
+static const flag_id flag_NO_RELOAD( "NO_RELOAD" );
+static const flag_id flag_NO_REPAIR( "NO_REPAIR" );
+static const flag_id flag_NO_SALVAGE( "NO_SALVAGE" );
+static const flag_id flag_NO_UNLOAD( "NO_UNLOAD" );
+static const flag_id flag_OUTER( "OUTER" );
+static const flag_id flag_PUMP_ACTION( "PUMP_ACTION" );
+static const flag_id flag_PUMP_RAIL_COMPATIBLE( "PUMP_RAIL_COMPATIBLE" );
+static const flag_id flag_RADIOACTIVE( "RADIOACTIVE" );
+static const flag_id flag_RADIOSIGNAL_1( "RADIOSIGNAL_1" );
+static const flag_id flag_RADIOSIGNAL_2( "RADIOSIGNAL_2" );
+static const flag_id flag_RADIOSIGNAL_3( "RADIOSIGNAL_3" );
+static const flag_id flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
+static const flag_id flag_RADIO_INVOKE_PROC( "RADIO_INVOKE_PROC" );
+static const flag_id flag_RADIO_MOD( "RADIO_MOD" );
+static const flag_id flag_RAPIDFIRE( "RAPIDFIRE" );
+static const flag_id flag_REACH3( "REACH3" );
+static const flag_id flag_REACH_ATTACK( "REACH_ATTACK" );
+static const flag_id flag_RECHARGE( "RECHARGE" );
+static const flag_id flag_REDUCED_BASHING( "REDUCED_BASHING" );
+static const flag_id flag_REDUCED_WEIGHT( "REDUCED_WEIGHT" );
+static const flag_id flag_RELOAD_EJECT( "RELOAD_EJECT" );
+static const flag_id flag_RELOAD_ONE( "RELOAD_ONE" );
+static const flag_id flag_REVIVE_SPECIAL( "REVIVE_SPECIAL" );
+static const flag_id flag_SKINTIGHT( "SKINTIGHT" );
+static const flag_id flag_SLOW_WIELD( "SLOW_WIELD" );
+static const flag_id flag_SPEEDLOADER( "SPEEDLOADER" );
+static const flag_id flag_STR_DRAW( "STR_DRAW" );
+static const flag_id flag_TOBACCO( "TOBACCO" );
+static const flag_id flag_UNARMED_WEAPON( "UNARMED_WEAPON" );
+static const flag_id flag_USE_UPS( "USE_UPS" );
+static const flag_id flag_VARSIZE( "VARSIZE" );
+static const flag_id flag_VEHICLE( "VEHICLE" );
+static const flag_id flag_WAIST( "WAIST" );
+static const flag_id flag_WATERPROOF_GUN( "WATERPROOF_GUN" );
+static const flag_id flag_WET( "WET" );
+
+static const item_var_key var_volume( "volume" );
+static const item_var_key var_weight( "weight" );
+
+static const ammotype ammo_battery( "battery" );
+static const ammotype ammo_bolt( "bolt" );
+static const ammotype ammo_plutonium( "plutonium" );
+
+static const bionic_id bio_digestion( "bio_digestion" );
+static const bionic_id bio_scent_vision( "bio_scent_vision" );
+
+static const trait_id trait_CARNIVORE( "CARNIVORE" );
+static const trait_id trait_DEBUG_CBM_SLOTS( "DEBUG_CBM_SLOTS" );
+static const trait_id trait_JITTERY( "JITTERY" );
+static const trait_id trait_LIGHTWEIGHT( "LIGHTWEIGHT" );
+static const trait_id trait_SAPROVORE( "SAPROVORE" );
+static const trait_id trait_SQUEAMISH( "SQUEAMISH" );
+static const trait_id trait_TOLERANCE( "TOLERANCE" );
 
 std::string const& rad_badge_color(int const rad)
 {
@@ -299,7 +393,7 @@ item& item::ammo_set( const itype_id& ammo, long qty )
     if( is_magazine() ) {
         ammo_unset();
         emplace_back( ammo, calendar::turn, std::min( qty, ammo_capacity() ) );
-        if( has_flag( "NO_UNLOAD" ) ) {
+        if( has_flag( flag_NO_UNLOAD ) ) {
             contents.back().item_tags.insert( "NO_DROP" );
             contents.back().item_tags.insert( "IRREMOVABLE" );
         }
@@ -395,7 +489,7 @@ bool item::is_null() const
 
 bool item::is_unarmed_weapon() const
 {
-    return has_flag( "UNARMED_WEAPON" ) || is_null();
+    return has_flag( flag_UNARMED_WEAPON ) || is_null();
 }
 
 bool item::covers( const body_part bp ) const
@@ -602,46 +696,44 @@ void item::put_in(item payload)
 
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( item_var_key( name ), static_cast<long>( value ) );
 }
 
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( item_var_key( name ), value );
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    item_vars.set( item_var_key( name ), value );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    // Most items don't have any variables, skip the key lookup for them.
+    if( item_vars.empty() ) {
         return default_value;
     }
-    return atof( it->second.c_str() );
+    return item_vars.get( item_var_key::find( name ), default_value );
+}
+
+double item::get_var( const item_var_key &name, const double default_value ) const
+{
+    return item_vars.get( name, default_value );
 }
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    item_vars.set( item_var_key( name ), value );
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    if( item_vars.empty() ) {
         return default_value;
     }
-    return it->second;
+    return item_vars.get( item_var_key::find( name ), default_value );
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -651,12 +743,12 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return !item_vars.empty() && item_vars.has( item_var_key::find( name ) );
 }
 
 void item::erase_var( const std::string &name )
 {
-    item_vars.erase( name );
+    item_vars.erase( item_var_key::find( name ) );
 }
 
 void item::clear_vars()
@@ -871,7 +963,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
 
         info.push_back( iteminfo( "FOOD", _( "Portions: " ), "", abs( int( food_item->charges ) * batch ) ) );
         if( food_item->corpse != NULL && ( debug || ( g != NULL &&
-                                           ( g->u.has_bionic( bionic_id( "bio_scent_vision" ) ) || g->u.has_trait( trait_id( "CARNIVORE" ) ) ||
+                                           ( g->u.has_bionic( bio_scent_vision ) || g->u.has_trait( trait_CARNIVORE ) ||
                                              g->u.has_artifact_with( AEP_SUPER_CLAIRVOYANCE ) ) ) ) ) {
             info.push_back( iteminfo( "FOOD", _( "Smells like: " ) + food_item->corpse->nname() ) );
         }
@@ -886,7 +978,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
             info.emplace_back( "FOOD", _( "Vitamins (RDA): " ), required_vits.c_str() );
         }
 
-        if( food_item->has_flag( "CANNIBALISM" ) ) {
+        if( food_item->has_flag( flag_CANNIBALISM ) ) {
             if( !g->u.has_trait_flag( "CANNIBAL" ) ) {
                 info.emplace_back( "DESCRIPTION", _( "* This food contains <bad>human flesh</bad>." ) );
             } else {
@@ -899,12 +991,12 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
         }
 
         ///\EFFECT_SURVIVAL >=3 allows detection of poisonous food
-        if( food_item->has_flag( "HIDDEN_POISON" ) && g->u.get_skill_level( skill_survival ) >= 3 ) {
+        if( food_item->has_flag( flag_HIDDEN_POISON ) && g->u.get_skill_level( skill_survival ) >= 3 ) {
             info.emplace_back( "DESCRIPTION", _( "* On closer inspection, this appears to be <bad>poisonous</bad>." ) );
         }
 
         ///\EFFECT_SURVIVAL >=5 allows detection of hallucinogenic food
-        if( food_item->has_flag( "HIDDEN_HALLU" ) && g->u.get_skill_level( skill_survival ) >= 5 ) {
+        if( food_item->has_flag( flag_HIDDEN_HALLU ) && g->u.get_skill_level( skill_survival ) >= 5 ) {
             info.emplace_back( "DESCRIPTION", _( "* On closer inspection, this appears to be <neutral>hallucinogenic</neutral>." ) );
         }
 
@@ -914,10 +1006,10 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
                                string_format( _( "* This food is <neutral>perishable</neutral>, and takes <info>%s</info> to rot from full freshness, at room temperature." ),
                                               rot_time.c_str() ) );
             if( food_item->rotten() ) {
-                if( g->u.has_bionic( bionic_id( "bio_digestion" ) ) ) {
+                if( g->u.has_bionic( bio_digestion ) ) {
                     info.push_back( iteminfo( "DESCRIPTION",
                                               _( "This food has started to <neutral>rot</neutral>, but <info>your bionic digestion can tolerate it</info>." ) ) );
-                } else if( g->u.has_trait( trait_id( "SAPROVORE" ) ) ) {
+                } else if( g->u.has_trait( trait_SAPROVORE ) ) {
                     info.push_back( iteminfo( "DESCRIPTION",
                                               _( "This food has started to <neutral>rot</neutral>, but <info>you can tolerate it</info>." ) ) );
                 } else {
@@ -928,7 +1020,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
         }
     }
 
-    if( is_magazine() && !has_flag( "NO_RELOAD" ) ) {
+    if( is_magazine() && !has_flag( flag_NO_RELOAD ) ) {
         info.emplace_back( "MAGAZINE", _( "Capacity: " ),
                            string_format( ngettext( "<num> round of %s", "<num> rounds of %s", ammo_capacity() ),
                                           ammo_type()->name().c_str() ), ammo_capacity(), true );
@@ -1108,7 +1200,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
             info.emplace_back( "GUN", _( "Sight dispersion: " ), "", eff_disp, true, "", true, true );
         }
 
-        bool bipod = mod->has_flag( "BIPOD" );
+        bool bipod = mod->has_flag( flag_BIPOD );
         if( aprox ) {
             if( aprox->gun_recoil( g->u ) ) {
                 info.emplace_back( "GUN", _( "Approximate recoil: " ), "",
@@ -1139,7 +1231,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
         }
 
         info.emplace_back( "GUN", _( "Reload time: " ),
-                           has_flag( "RELOAD_ONE" ) ? _( "<num> seconds per round" ) : _( "<num> seconds" ),
+                           has_flag( flag_RELOAD_ONE ) ? _( "<num> seconds per round" ) : _( "<num> seconds" ),
                            int( gun.reload_time / 16.67 ), true, "", true, true );
 
         std::vector<std::string> fm;
@@ -1207,7 +1299,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "This mod <info>must be attached to a gun</info>, it can not be fired separately." ) ) );
         }
-        if( has_flag( "REACH_ATTACK" ) ) {
+        if( has_flag( flag_REACH_ATTACK ) ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "When attached to a gun, <good>allows</good> making <info>reach melee attacks</info> with it." ) ) );
         }
@@ -1314,13 +1406,13 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
 
         temp1.str( "" );
         temp1 << _( "Layer: " );
-        if( has_flag( "SKINTIGHT" ) ) {
+        if( has_flag( flag_SKINTIGHT ) ) {
             temp1 << _( "<stat>Close to skin</stat>. " );
-        } else if( has_flag( "BELTED" ) ) {
+        } else if( has_flag( flag_BELTED ) ) {
             temp1 << _( "<stat>Strapped</stat>. " );
-        } else if( has_flag( "OUTER" ) ) {
+        } else if( has_flag( flag_OUTER ) ) {
             temp1 << _( "<stat>Outer</stat>. " );
-        } else if( has_flag( "WAIST" ) ) {
+        } else if( has_flag( flag_WAIST ) ) {
             temp1 << _( "<stat>Waist</stat>. " );
         } else {
             temp1 << _( "<stat>Normal</stat>. " );
@@ -1333,7 +1425,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
 
         insert_separation_line();
 
-        if( has_flag( "FIT" ) ) {
+        if( has_flag( flag_FIT ) ) {
             info.push_back( iteminfo( "ARMOR", _( "<bold>Encumbrance</bold>: " ),
                                       _( "<num> <info>(fits)</info>" ),
                                       get_encumber(), true, "", false, true ) );
@@ -1546,14 +1638,12 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
     }
 
     if( showtext && !is_null() ) {
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
         insert_separation_line();
         if( !type->snippet_category.empty() ) {
             // Just use the dynamic description
             info.push_back( iteminfo( "DESCRIPTION", SNIPPET.get( note ) ) );
-        } else if( idescription != item_vars.end() ) {
-            info.push_back( iteminfo( "DESCRIPTION", idescription->second ) );
+        } else if( has_var( "description" ) ) {
+            info.push_back( iteminfo( "DESCRIPTION", get_var( "description" ) ) );
         } else {
             info.push_back( iteminfo( "DESCRIPTION", _( type->description.c_str() ) ) );
         }
@@ -1567,9 +1657,9 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
             } ) ) );
         }
 
-        if( !is_gunmod() && has_flag( "REACH_ATTACK" ) ) {
+        if( !is_gunmod() && has_flag( flag_REACH_ATTACK ) ) {
             insert_separation_line();
-            if( has_flag( "REACH3" ) ) {
+            if( has_flag( flag_REACH3 ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This item can be used to make <stat>long reach attacks</stat>." ) ) );
             } else {
@@ -1645,7 +1735,7 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
 
         if( !conductive () ) {
             info.push_back( iteminfo( "BASE", string_format( _( "* This item <good>does not conduct</good> electricity." ) ) ) );
-        } else if( has_flag( "CONDUCTIVE" ) ) {
+        } else if( has_flag( flag_CONDUCTIVE ) ) {
             info.push_back( iteminfo( "BASE", string_format( _( "* This item effectively <bad>conducts</bad> electricity, as it has no guard." ) ) ) );
         } else {
             info.push_back( iteminfo( "BASE", string_format( _( "* This item <bad>conducts</bad> electricity." ) ) ) );
@@ -1666,15 +1756,15 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
         }
 
         if( is_armor() ) {
-            if( has_flag( "HELMET_COMPAT" ) ) {
+            if( has_flag( flag_HELMET_COMPAT ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This item can be <info>worn with a helmet</info>." ) ) );
             }
 
-            if( has_flag( "FIT" ) ) {
+            if( has_flag( flag_FIT ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This piece of clothing <info>fits</info> you perfectly." ) ) );
-            } else if( has_flag( "VARSIZE" ) ) {
+            } else if( has_flag( flag_VARSIZE ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This piece of clothing <info>can be refitted</info>." ) ) );
             }
@@ -1701,63 +1791,63 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
         }
 
         if( is_tool() ) {
-            if( has_flag( "USE_UPS" ) ) {
+            if( has_flag( flag_USE_UPS ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This tool has been modified to use a <info>universal power supply</info> and is <neutral>not compatible</neutral> with <info>standard batteries</info>." ) ) );
-            } else if( has_flag( "RECHARGE" ) && has_flag( "NO_RELOAD" ) ) {
+            } else if( has_flag( flag_RECHARGE ) && has_flag( flag_NO_RELOAD ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                                           _( "* This tool has a <info>rechargeable power cell</info> and is <neutral>not compatible</neutral> with <info>standard batteries</info>." ) ) );
-            } else if( has_flag( "RECHARGE" ) ) {
+            } else if( has_flag( flag_RECHARGE ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
                     _( "* This tool has a <info>rechargeable power cell</info> and can be recharged in any <neutral>UPS-compatible recharging station</neutral>. You could charge it with <info>standard batteries</info>, but unloading it is impossible." ) ) );
             }
         }
 
-        if( has_flag( "RADIO_ACTIVATION" ) ) {
-            if( has_flag( "RADIO_MOD" ) ) {
+        if( has_flag( flag_RADIO_ACTIVATION ) ) {
+            if( has_flag( flag_RADIO_MOD ) ) {
                 info.emplace_back( "DESCRIPTION", _( "* This item has been modified to listen to <info>radio signals</info>.  It can still be activated manually." ) );
             } else {
                 info.emplace_back( "DESCRIPTION", _( "* This item can only be activated by a <info>radio signal</info>." ) );
             }
 
             std::string signame;
-            if( has_flag( "RADIOSIGNAL_1" ) ) {
+            if( has_flag( flag_RADIOSIGNAL_1 ) ) {
                 signame = "<color_c_red>red</color> radio signal.";
-            } else if( has_flag( "RADIOSIGNAL_2" ) ) {
+            } else if( has_flag( flag_RADIOSIGNAL_2 ) ) {
                 signame = "<color_c_blue>blue</color> radio signal.";
-            } else if( has_flag( "RADIOSIGNAL_3" ) ) {
+            } else if( has_flag( flag_RADIOSIGNAL_3 ) ) {
                 signame = "<color_c_green>green</color> radio signal.";
             }
 
             info.emplace_back( "DESCRIPTION", string_format( _( "* It will be activated by the %s." ), signame.c_str() ) );
 
-            if( has_flag( "RADIO_INVOKE_PROC" ) ) {
+            if( has_flag( flag_RADIO_INVOKE_PROC ) ) {
                 info.emplace_back( "DESCRIPTION",_( "* Activating this item with a <info>radio signal</info> will <neutral>detonate</neutral> it immediately." ) );
             }
         }
 
         // @todo: Unhide when enforcing limits
-        if( is_bionic() && g->u.has_trait( trait_id( "DEBUG_CBM_SLOTS" ) ) ) {
+        if( is_bionic() && g->u.has_trait( trait_DEBUG_CBM_SLOTS ) ) {
             info.push_back( iteminfo( "DESCRIPTION", list_occupied_bps( type->bionic->id,
                 _( "This bionic is installed in the following body part(s):" ) ) ) );
         }
 
-        if( is_gun() && has_flag( "FIRE_TWOHAND" ) ) {
+        if( is_gun() && has_flag( flag_FIRE_TWOHAND ) ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "* This weapon needs <info>two free hands</info> to fire." ) ) );
         }
 
-        if( is_gunmod() && has_flag( "DISABLE_SIGHTS" ) ) {
+        if( is_gunmod() && has_flag( flag_DISABLE_SIGHTS ) ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "* This mod <bad>obscures sights</bad> of the base weapon." ) ) );
         }
 
-        if( has_flag( "LEAK_DAM" ) && has_flag( "RADIOACTIVE" ) && damage() > 0 ) {
+        if( has_flag( flag_LEAK_DAM ) && has_flag( flag_RADIOACTIVE ) && damage() > 0 ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "* The casing of this item has <neutral>cracked</neutral>, revealing an <info>ominous green glow</info>." ) ) );
         }
 
-        if( has_flag( "LEAK_ALWAYS" ) && has_flag( "RADIOACTIVE" ) ) {
+        if( has_flag( flag_LEAK_ALWAYS ) && has_flag( flag_RADIOACTIVE ) ) {
             info.push_back( iteminfo( "DESCRIPTION",
                                       _( "* This object is <neutral>surrounded</neutral> by a <info>sickly green glow</info>." ) ) );
         }
@@ -1821,20 +1911,16 @@ std::string item::info( bool showtext, std::vector<iteminfo> &info, int batch )
             }
         }
 
-        std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
-        std::map<std::string, std::string>::const_iterator item_note_type =
-            item_vars.find( "item_note_type" );
-
-        if( item_note != item_vars.end() ) {
+        if( has_var( "item_note" ) ) {
             insert_separation_line();
             std::string ntext = "";
-            if( item_note_type != item_vars.end() ) {
+            if( has_var( "item_note_type" ) ) {
                 ntext += string_format( _( "%1$s on the %2$s is: " ),
-                                        item_note_type->second.c_str(), tname().c_str() );
+                                        get_var( "item_note_type" ).c_str(), tname().c_str() );
             } else {
                 ntext += _( "Note: " );
             }
-            info.push_back( iteminfo( "DESCRIPTION", ntext + item_note->second ) );
+            info.push_back( iteminfo( "DESCRIPTION", ntext + get_var( "item_note" ) ) );
         }
 
         // describe contents
@@ -1961,13 +2047,13 @@ nc_color item::color_in_inventory() const
     player &u = g->u; // TODO: make a const reference
     nc_color ret = c_light_gray;
 
-    if(has_flag("WET")) {
+    if(has_flag(flag_WET)) {
         ret = c_cyan;
-    } else if(has_flag("LITCIG")) {
+    } else if(has_flag(flag_LITCIG)) {
         ret = c_red;
     } else if( is_filthy() ) {
         ret = c_brown;
-    } else if ( has_flag("LEAK_DAM") && has_flag("RADIOACTIVE") && damage() > 0 ) {
+    } else if ( has_flag(flag_LEAK_DAM) && has_flag(flag_RADIOACTIVE) && damage() > 0 ) {
         ret = c_light_green;
     } else if (active && !is_food() && !is_food_container()) { // Active items show up as yellow
         ret = c_yellow;
@@ -2125,7 +2211,7 @@ void item::on_wield( player &p, int mv )
     }
 
     // weapons with bayonet/bipod or other generic "unhandiness"
-    if( has_flag("SLOW_WIELD") && !is_gunmod() ) {
+    if( has_flag(flag_SLOW_WIELD) && !is_gunmod() ) {
         float d = 32.0; // arbitrary linear scaling factor
         if( is_gun() ) {
             d /= std::max( p.get_skill_level( gun_skill() ), 1 );
@@ -2139,7 +2225,7 @@ void item::on_wield( player &p, int mv )
     }
 
     // firearms with a folding stock or tool/melee without collapse/retract iuse
-    if( has_flag( "NEEDS_UNFOLD" ) && !is_gunmod() ) {
+    if( has_flag( flag_NEEDS_UNFOLD ) && !is_gunmod() ) {
         int penalty = 50; // 200-300 for guns, 50-150 for melee, 50 as fallback
         if( is_gun() ) {
             penalty = std::max( 0, 300 - p.get_skill_level( gun_skill() ) * 10 );
@@ -2262,7 +2348,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
     }
 
     std::string maintext;
-    if( is_corpse() || typeId() == "blood" || item_vars.find( "name" ) != item_vars.end() ) {
+    if( is_corpse() || typeId() == "blood" || has_var( "name" ) ) {
         maintext = type_name( quantity );
     } else if( is_gun() || is_tool() || is_magazine() ) {
         ret.str("");
@@ -2307,15 +2393,15 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
             ret << _( " (fresh)" );
         }
 
-        if( has_flag( "HOT" ) ) {
+        if( has_flag( flag_HOT ) ) {
             ret << _( " (hot)" );
         }
-        if( has_flag( "COLD" ) ) {
+        if( has_flag( flag_COLD ) ) {
             ret << _( " (cold)" );
         }
     }
 
-    if( has_flag( "FIT" ) ) {
+    if( has_flag( flag_FIT ) ) {
         ret << _( " (fits)" );
     }
 
@@ -2323,16 +2409,16 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
         ret << _( " (filthy)" );
     }
 
-    if( is_tool() && has_flag( "USE_UPS" ) ){
+    if( is_tool() && has_flag( flag_USE_UPS ) ){
         ret << _( " (UPS)" );
     }
-    if( has_flag( "RADIO_MOD" ) ) {
+    if( has_flag( flag_RADIO_MOD ) ) {
         ret << _( " (radio:" );
-        if( has_flag( "RADIOSIGNAL_1" ) ) {
+        if( has_flag( flag_RADIOSIGNAL_1 ) ) {
             ret << pgettext( "The radio mod is associated with the [R]ed button.", "R)" );
-        } else if( has_flag( "RADIOSIGNAL_2" ) ) {
+        } else if( has_flag( flag_RADIOSIGNAL_2 ) ) {
             ret << pgettext( "The radio mod is associated with the [B]lue button.", "B)" );
-        } else if( has_flag( "RADIOSIGNAL_3" ) ) {
+        } else if( has_flag( flag_RADIOSIGNAL_3 ) ) {
             ret << pgettext( "The radio mod is associated with the [G]reen button.", "G)" );
         } else {
             debugmsg( "Why is the radio neither red, blue, nor green?" );
@@ -2340,10 +2426,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
         }
     }
 
-    if( has_flag( "WET" ) ) {
+    if( has_flag( flag_WET ) ) {
        ret << _( " (wet)" );
     }
-    if( has_flag( "LITCIG" ) ) {
+    if( has_flag( flag_LITCIG ) ) {
         ret << _( " (lit)" );
     }
     if( already_used_by_player( g->u ) ) {
@@ -2362,7 +2448,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
     if( gunmod_find( "barrel_small" ) ) {
         modtext += _( "sawn-off " );
     }
-    if( has_flag( "DIAMOND" ) ) {
+    if( has_flag( flag_DIAMOND ) ) {
         modtext += std::string( _( "diamond" ) ) + " ";
     }
 
@@ -2371,7 +2457,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
     ret << string_format( _( "%1$s%2$s%3$s%4$s%5$s%6$s" ), damtext.c_str(), burntext.c_str(),
                           modtext.c_str(), vehtext.c_str(), maintext.c_str(), tagtext.c_str() );
 
-    if( item_vars.find( "item_note" ) != item_vars.end() ) {
+    if( has_var( "item_note" ) ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format( _( "*%s*" ), ret.str().c_str() );
     } else {
@@ -2481,12 +2567,12 @@ units::mass item::weight( bool include_contents ) const
     }
 
     // Items that don't drop aren't really there, they're items just for ease of implementation
-    if( has_flag( "NO_DROP" ) ) {
+    if( has_flag( flag_NO_DROP ) ) {
         return 0;
     }
 
-    units::mass ret = units::from_gram( get_var( "weight", to_gram( type->weight ) ) );
-    if( has_flag( "REDUCED_WEIGHT" ) ) {
+    units::mass ret = units::from_gram( get_var( var_weight, to_gram( type->weight ) ) );
+    if( has_flag( flag_REDUCED_WEIGHT ) ) {
         ret *= 0.75;
     }
 
@@ -2501,17 +2587,17 @@ units::mass item::weight( bool include_contents ) const
             case MS_LARGE:  ret = 120000_gram;  break;
             case MS_HUGE:   ret = 200000_gram;  break;
         }
-        if( made_of( material_id( "veggy" ) ) ) {
+        if( made_of( mat_veggy ) ) {
             ret /= 3;
         }
-        if( corpse->in_species( FISH ) || corpse->in_species( BIRD ) || corpse->in_species( INSECT ) || made_of( material_id( "bone" ) ) ) {
+        if( corpse->in_species( FISH ) || corpse->in_species( BIRD ) || corpse->in_species( INSECT ) || made_of( mat_bone ) ) {
             ret /= 8;
-        } else if ( made_of( material_id( "iron" ) ) || made_of( material_id( "steel" ) ) || made_of( material_id( "stone" ) ) ) {
+        } else if ( made_of( mat_iron ) || made_of( mat_steel ) || made_of( mat_stone ) ) {
             ret *= 7;
         }
 
     } else if( magazine_integral() && !is_magazine() ) {
-        if ( ammo_type() == ammotype( "plutonium" ) ) {
+        if ( ammo_type() == ammo_plutonium ) {
             ret += ammo_remaining() * find_type( ammo_type()->default_ammotype() )->weight / PLUTONIUM_CHARGES;
         } else if( ammo_data() ) {
             ret += ammo_remaining() * ammo_data()->weight;
@@ -2578,7 +2664,7 @@ units::volume item::volume( bool integral ) const
         return corpse_volume( corpse->size );
     }
 
-    const int local_volume = get_var( "volume", -1 );
+    const int local_volume = get_var( var_volume, -1 );
     units::volume ret;
     if( local_volume >= 0 ) {
         ret = local_volume * units::legacy_volume_factor;
@@ -2610,9 +2696,9 @@ units::volume item::volume( bool integral ) const
         }
 
         // @todo: implement stock_length property for guns
-        if (has_flag("COLLAPSIBLE_STOCK")) {
+        if( has_flag( flag_COLLAPSIBLE_STOCK ) ) {
             // consider only the base size of the gun (without mods)
-            int tmpvol = get_var( "volume", ( type->volume - type->gun->barrel_length ) / units::legacy_volume_factor );
+            int tmpvol = get_var( var_volume, ( type->volume - type->gun->barrel_length ) / units::legacy_volume_factor );
             if     ( tmpvol <=  3 ) ; // intentional NOP
             else if( tmpvol <=  5 ) ret -=  250_ml;
             else if( tmpvol <=  6 ) ret -=  500_ml;
@@ -2655,14 +2741,14 @@ int item::damage_melee( damage_type dt ) const
     // apply type specific flags
     switch( dt ) {
         case DT_BASH:
-            if( has_flag( "REDUCED_BASHING" ) ) {
+            if( has_flag( flag_REDUCED_BASHING ) ) {
                 res *= 0.5;
             }
             break;
 
         case DT_CUT:
         case DT_STAB:
-            if( has_flag( "DIAMOND" ) ) {
+            if( has_flag( flag_DIAMOND ) ) {
                 res *= 1.3;
             }
             break;
@@ -2711,8 +2797,8 @@ int item::reach_range( const player &p ) const
 {
     int res = 1;
 
-    if( has_flag( "REACH_ATTACK" ) ) {
-        res = has_flag( "REACH3" ) ? 3 : 2;
+    if( has_flag( flag_REACH_ATTACK ) ) {
+        res = has_flag( flag_REACH3 ) ? 3 : 2;
     }
 
     // for guns consider any attached gunmods
@@ -2739,9 +2825,14 @@ void item::unset_flags()
 
 bool item::has_flag( const std::string &f ) const
 {
-    bool ret = false;
+    // Flags that were never interned can not be in any flag set.
+    return has_flag( flag_id::find( f ) );
+}
 
-    if( json_flag::get( f ).inherit() ) {
+bool item::has_flag( const flag_id &f ) const
+{
+    // mods are stored in the contents, skip building the list when there can't be any
+    if( !contents.empty() && f.inherit() ) {
         for( const auto e : is_gun() ? gunmods() : toolmods() ) {
             // gunmods fired separately do not contribute to base gun flags
             if( !e->is_gun() && e->has_flag( f ) ) {
@@ -2750,15 +2841,8 @@ bool item::has_flag( const std::string &f ) const
         }
     }
 
-    // other item type flags
-    ret = type->item_tags.count(f);
-    if (ret) {
-        return ret;
-    }
-
-    // now check for item specific flags
-    ret = item_tags.count(f);
-    return ret;
+    // item type flags, then item specific flags
+    return type->item_tags.has( f ) || item_tags.has( f );
 }
 
 bool item::has_any_flag( const std::vector<std::string>& flags ) const
@@ -3008,7 +3092,7 @@ int item::get_encumber() const
     }
 
     // Fit checked before changes, fitting shouldn't reduce penalties from patching.
-    if( item_tags.count("FIT") && has_flag( "VARSIZE" ) ) {
+    if( item_tags.has( flag_FIT ) && has_flag( flag_VARSIZE ) ) {
         encumber = std::max( encumber / 2, encumber - 10 );
     }
 
@@ -3033,13 +3117,13 @@ int item::get_encumber() const
 
 int item::get_layer() const
 {
-    if( has_flag("SKINTIGHT") ) {
+    if( has_flag(flag_SKINTIGHT) ) {
         return UNDERWEAR;
-    } else if( has_flag("WAIST") ) {
+    } else if( has_flag(flag_WAIST) ) {
         return WAIST_LAYER;
-    } else if( has_flag("OUTER") ) {
+    } else if( has_flag(flag_OUTER) ) {
         return OUTER_LAYER;
-    } else if( has_flag("BELTED") ) {
+    } else if( has_flag(flag_BELTED) ) {
         return BELTED_LAYER;
     }
     return REGULAR_LAYER;
@@ -3120,7 +3204,7 @@ bool item::ready_to_revive( const tripoint &pos ) const
     int rez_factor = 48 - age_in_hours;
     if( age_in_hours > 6 && (rez_factor <= 0 || one_in(rez_factor)) ) {
         // If we're a special revival zombie, wait to get up until the player is nearby.
-        const bool isReviveSpecial = has_flag("REVIVE_SPECIAL");
+        const bool isReviveSpecial = has_flag(flag_REVIVE_SPECIAL);
         if( isReviveSpecial ) {
             const int distance = rl_dist( pos, g->u.pos() );
             if (distance > 3) {
@@ -3420,7 +3504,7 @@ std::string item::damage_symbol() const
 const std::set<itype_id>& item::repaired_with() const
 {
     static std::set<itype_id> no_repair;
-    return has_flag( "NO_REPAIR" )  ? no_repair : type->repair;
+    return has_flag( flag_NO_REPAIR )  ? no_repair : type->repair;
 }
 
 void item::mitigate_damage( damage_unit &du ) const
@@ -3464,7 +3548,7 @@ int item::damage_resist( damage_type dt, bool to_self ) const
 
 bool item::is_two_handed( const player &u ) const
 {
-    if( has_flag("ALWAYS_TWOHAND") ) {
+    if( has_flag(flag_ALWAYS_TWOHAND) ) {
         return true;
     }
     ///\EFFECT_STR determines which weapons can be wielded with one hand
@@ -3533,11 +3617,11 @@ bool item::conductive() const
         return false;
     }
 
-    if( has_flag( "CONDUCTIVE" ) ) {
+    if( has_flag( flag_CONDUCTIVE ) ) {
         return true;
     }
 
-    if( has_flag( "NONCONDUCTIVE" ) ) {
+    if( has_flag( flag_NONCONDUCTIVE ) ) {
         return false;
     }
 
@@ -3586,7 +3670,7 @@ bool item::is_magazine() const
 
 bool item::is_ammo_belt() const
 {
-    return is_magazine() && has_flag( "MAG_BELT" );
+    return is_magazine() && has_flag( flag_MAG_BELT );
 }
 
 bool item::is_bandolier() const
@@ -3683,7 +3767,7 @@ const islot_armor *item::find_armor_data() const
 
 bool item::is_armor() const
 {
-    return find_armor_data() != nullptr || has_flag( "IS_ARMOR" );
+    return find_armor_data() != nullptr || has_flag( flag_IS_ARMOR );
 }
 
 bool item::is_book() const
@@ -3749,7 +3833,7 @@ bool item::is_faulty() const
 
 bool item::is_irremovable() const
 {
-    return has_flag( "IRREMOVABLE" );
+    return has_flag( flag_IRREMOVABLE );
 }
 
 std::set<fault_id> item::faults_potential() const
@@ -3826,7 +3910,7 @@ bool item::is_salvageable() const
     if( is_null() ) {
         return false;
     }
-    return !has_flag("NO_SALVAGE");
+    return !has_flag(flag_NO_SALVAGE);
 }
 
 bool item::is_funnel_container(units::volume &bigger_than) const
@@ -4014,7 +4098,7 @@ gun_type_type item::gun_type() const
     //@todo: move to JSON and remove extraction of this from "GUN" (via skill id)
     //and from "GUNMOD" (via "mod_targets") in lang/extract_json_strings.py
     if( gun_skill() == skill_archery ) {
-        if( ammo_type() == ammotype( "bolt" ) || typeId() == "bullet_crossbow" ) {
+        if( ammo_type() == ammo_bolt || typeId() == "bullet_crossbow" ) {
             return gun_type_type( translate_marker_context( "gun_type_type", "crossbow" ) );
         } else{
             return gun_type_type( translate_marker_context( "gun_type_type", "bow" ) );
@@ -4029,7 +4113,7 @@ skill_id item::melee_skill() const
         return skill_id::NULL_ID();
     }
 
-    if( has_flag( "UNARMED_WEAPON" ) ) {
+    if( has_flag( flag_UNARMED_WEAPON ) ) {
         return skill_unarmed;
     }
 
@@ -4078,7 +4162,7 @@ int item::sight_dispersion() const
         return 0;
     }
 
-    int res = has_flag( "DISABLE_SIGHTS" ) ? 90 : type->gun->sight_dispersion;
+    int res = has_flag( flag_DISABLE_SIGHTS ) ? 90 : type->gun->sight_dispersion;
 
     for( const auto e : gunmods() ) {
         const auto &mod = *e->type->gunmod;
@@ -4125,7 +4209,7 @@ int item::gun_recoil( const player &p, bool bipod ) const
 
     double handling = type->gun->handling;
     for( const auto mod : gunmods() ) {
-        if( bipod || !mod->has_flag( "BIPOD" ) ) {
+        if( bipod || !mod->has_flag( flag_BIPOD ) ) {
             handling += mod->type->gunmod->handling;
         }
     }
@@ -4175,7 +4259,7 @@ int item::gun_range( const player *p ) const
     }
 
     // Reduce bow range until player has twice minimm required strength
-    if( has_flag( "STR_DRAW" ) ) {
+    if( has_flag( flag_STR_DRAW ) ) {
         ret += std::max( 0.0, ( p->get_str() - type->min_str ) * 0.5 );
     }
 
@@ -4248,11 +4332,11 @@ long item::ammo_required() const
     if( is_gun() ) {
         if( !ammo_type() ) {
             return 0;
-        } else if( has_flag( "FIRE_100" ) ) {
+        } else if( has_flag( flag_FIRE_100 ) ) {
             return 100;
-        } else if( has_flag( "FIRE_50" ) ) {
+        } else if( has_flag( flag_FIRE_50 ) ) {
             return 50;
-        } else if( has_flag( "FIRE_20" ) ) {
+        } else if( has_flag( flag_FIRE_20 ) ) {
             return 20;
         } else {
             return 1;
@@ -4276,11 +4360,11 @@ long item::ammo_consume( long qty, const tripoint& pos ) {
     if( mag ) {
         auto res = mag->ammo_consume( qty, pos );
         if( res && ammo_remaining() == 0 ) {
-            if( mag->has_flag( "MAG_DESTROY" ) ) {
+            if( mag->has_flag( flag_MAG_DESTROY ) ) {
                 contents.erase( std::remove_if( contents.begin(), contents.end(), [&mag]( const item& e ) {
                     return mag == &e;
                 } ) );
-            } else if ( mag->has_flag( "MAG_EJECT" ) ) {
+            } else if ( mag->has_flag( flag_MAG_EJECT ) ) {
                 g->m.add_item( pos, *mag );
                 contents.erase( std::remove_if( contents.begin(), contents.end(), [&mag]( const item& e ) {
                     return mag == &e;
@@ -4513,7 +4597,7 @@ ret_val<bool> item::is_gunmod_compatible( const item& mod ) const
     } else if( typeId() == "hand_crossbow" && !!mod.type->gunmod->usable.count( pistol_gun_type ) ) {
         return ret_val<bool>::make_failure( _("isn't big enough to use that mod") );
 
-    } else if( mod.type->gunmod->location.str() == "underbarrel" && !mod.has_flag( "PUMP_RAIL_COMPATIBLE" ) && has_flag( "PUMP_ACTION" ) ) {
+    } else if( mod.type->gunmod->location.str() == "underbarrel" && !mod.has_flag( flag_PUMP_RAIL_COMPATIBLE ) && has_flag( flag_PUMP_ACTION ) ) {
         return ret_val<bool>::make_failure( _("can only accept small mods on that slot") );
 
     } else if ( !mod.type->mod->acceptable_ammo.empty() && !mod.type->mod->acceptable_ammo.count( ammo_type( false ) ) ) {
@@ -4521,13 +4605,13 @@ ret_val<bool> item::is_gunmod_compatible( const item& mod ) const
         return ret_val<bool>::make_failure( _( "%1$s cannot be used on %2$s" ), mod.tname( 1 ).c_str(),
                                             ammo_type( false )->name().c_str() );
 
-    } else if( mod.typeId() == "waterproof_gunmod" && has_flag( "WATERPROOF_GUN" ) ) {
+    } else if( mod.typeId() == "waterproof_gunmod" && has_flag( flag_WATERPROOF_GUN ) ) {
         return ret_val<bool>::make_failure( _( "is already waterproof" ) );
 
-    } else if( mod.typeId() == "tuned_mechanism" && has_flag( "NEVER_JAMS" ) ) {
+    } else if( mod.typeId() == "tuned_mechanism" && has_flag( flag_NEVER_JAMS ) ) {
         return ret_val<bool>::make_failure( _( "is already eminently reliable" ) );
 
-    } else if( mod.typeId() == "brass_catcher" && has_flag( "RELOAD_EJECT" ) ) {
+    } else if( mod.typeId() == "brass_catcher" && has_flag( flag_RELOAD_EJECT ) ) {
         return ret_val<bool>::make_failure( _( "cannot have a brass catcher" ) );
 
     } else if( ( mod.type->mod->ammo_modifier || !mod.type->mod->magazine_adaptor.empty() )
@@ -4559,7 +4643,7 @@ std::map<gun_mode_id, gun_mode> item::gun_all_modes() const
                 std::transform( prefix.begin(), prefix.end(), prefix.begin(), (int(*)(int))std::toupper );
 
                 auto qty = m.second.qty();
-                if( m.first == gun_mode_id( "AUTO" ) && e == this && has_flag( "RAPIDFIRE" ) ) {
+                if( m.first == gun_mode_id( "AUTO" ) && e == this && has_flag( flag_RAPIDFIRE ) ) {
                     qty *= 1.5;
                 }
 
@@ -4675,7 +4759,7 @@ int item::units_remaining( const Character& ch, int limit ) const
     }
 
     auto res = ammo_remaining();
-    if( res < limit && has_flag( "USE_UPS" ) ) {
+    if( res < limit && has_flag( flag_USE_UPS ) ) {
         res += ch.charges_of( "UPS", limit - res );
     }
 
@@ -4748,10 +4832,10 @@ void item::reload_option::qty( long val )
     long remaining_capacity = target->is_watertight_container() ?
         target->get_remaining_capacity_for_liquid( ammo_obj, true ) :
         target->ammo_capacity() - target->ammo_remaining();
-    if( target->has_flag( "RELOAD_ONE" ) && !ammo->has_flag( "SPEEDLOADER" ) ) {
+    if( target->has_flag( flag_RELOAD_ONE ) && !ammo->has_flag( flag_SPEEDLOADER ) ) {
         remaining_capacity = 1;
     }
-    if( target->ammo_type() == ammotype( "plutonium" ) ) {
+    if( target->ammo_type() == ammo_plutonium ) {
         remaining_capacity = remaining_capacity / PLUTONIUM_CHARGES +
             ( remaining_capacity % PLUTONIUM_CHARGES != 0 );
     }
@@ -4786,7 +4870,7 @@ void item::casings_handle( const std::function<bool(item &)> &func )
     }
 
     for( auto it = contents.begin(); it != contents.end(); ) {
-        if( it->has_flag( "CASING" ) ) {
+        if( it->has_flag( flag_CASING ) ) {
             it->unset_flag( "CASING" );
             if( func( *it ) ) {
                 it = contents.erase( it );
@@ -4826,7 +4910,7 @@ bool item::reload( player &u, item_location loc, long qty )
         ? get_remaining_capacity_for_liquid( *ammo )
         : ammo_capacity() - ammo_remaining();
 
-    if( ammo_type() == ammotype( "plutonium" ) ) {
+    if( ammo_type() == ammo_plutonium ) {
         limit = limit / PLUTONIUM_CHARGES + ( limit % PLUTONIUM_CHARGES != 0 );
     }
 
@@ -4878,12 +4962,12 @@ bool item::reload( player &u, item_location loc, long qty )
         return true;
 
     } else {
-        if( ammo->has_flag( "SPEEDLOADER" ) ) {
+        if( ammo->has_flag( flag_SPEEDLOADER ) ) {
             curammo = find_type( ammo->contents.front().typeId() );
             qty = std::min( qty, ammo->ammo_remaining() );
             ammo->ammo_consume( qty, { 0, 0, 0 } );
             charges += qty;
-        } else if( ammo_type() == ammotype( "plutonium" ) ) {
+        } else if( ammo_type() == ammo_plutonium ) {
             curammo = find_type( ammo->typeId() );
             ammo->charges -= qty;
 
@@ -4898,7 +4982,7 @@ bool item::reload( player &u, item_location loc, long qty )
         }
     }
 
-    if( ammo->charges == 0 && !ammo->has_flag( "SPEEDLOADER" ) ) {
+    if( ammo->charges == 0 && !ammo->has_flag( flag_SPEEDLOADER ) ) {
         if( container != nullptr ) {
             container->contents.erase(container->contents.begin());
             u.inv.restack( u ); // emptied containers do not stack with non-empty ones
@@ -5056,7 +5140,7 @@ int item::getlight_emit() const
     if ( lumint == 0 ) {
         return 0;
     }
-    if ( has_flag("CHARGEDIM") && is_tool() && !has_flag("USE_UPS")) {
+    if ( has_flag(flag_CHARGEDIM) && is_tool() && !has_flag(flag_USE_UPS)) {
         // Falloff starts at 1/5 total charge and scales linearly from there to 0.
         if( ammo_capacity() && ammo_remaining() < ( ammo_capacity() / 5 ) ) {
             lumint *= ammo_remaining() * 5.0 / ammo_capacity();
@@ -5164,7 +5248,7 @@ bool item::use_amount(const itype_id &it, long &quantity, std::list<item> &used)
 bool item::allow_crafting_component() const
 {
     // vehicle batteries are implemented as magazines of charge
-    if( is_magazine() && ammo_type() == ammotype( "battery" ) ) {
+    if( is_magazine() && ammo_type() == ammo_battery ) {
         return true;
     }
 
@@ -5415,26 +5499,26 @@ bool item_compare_by_charges( const item& left, const item& right)
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player(const player &p) const
 {
-    const auto it = item_vars.find( USED_BY_IDS );
-    if( it == item_vars.end() ) {
+    if( !has_var( USED_BY_IDS ) ) {
         return false;
     }
     // USED_BY_IDS always starts *and* ends with a ';', the search string
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID() );
-    return it->second.find( needle ) != std::string::npos;
+    return get_var( USED_BY_IDS ).find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player(const player &p)
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster ( const item& obj, bool ignore ) const {
@@ -5474,7 +5558,7 @@ std::string item::components_to_string() const
 
 bool item::needs_processing() const
 {
-    return active || has_flag("RADIO_ACTIVATION") ||
+    return active || has_flag(flag_RADIO_ACTIVATION) ||
            ( is_container() && !contents.empty() && contents.front().needs_processing() ) ||
            is_artifact();
 }
@@ -5563,7 +5647,7 @@ bool item::process_corpse( player *carrier, const tripoint &pos )
 bool item::process_litcig( player *carrier, const tripoint &pos )
 {
     field_id smoke_type;
-    if( has_flag( "TOBACCO" ) ) {
+    if( has_flag( flag_TOBACCO ) ) {
         smoke_type = fd_cigsmoke;
     } else {
         smoke_type = fd_weedsmoke;
@@ -5573,13 +5657,13 @@ bool item::process_litcig( player *carrier, const tripoint &pos )
         // only puff every other turn
         if( item_counter % 2 == 0 ) {
             time_duration duration = 1_minutes;
-            if( carrier->has_trait( trait_id( "TOLERANCE" ) ) ) {
+            if( carrier->has_trait( trait_TOLERANCE ) ) {
                 duration = 5_turns;
-            } else if( carrier->has_trait( trait_id( "LIGHTWEIGHT" ) ) ) {
+            } else if( carrier->has_trait( trait_LIGHTWEIGHT ) ) {
                 duration = 2_minutes;
             }
             carrier->add_msg_if_player( m_neutral, _( "You take a puff of your %s." ), tname().c_str() );
-            if( has_flag( "TOBACCO" ) ) {
+            if( has_flag( flag_TOBACCO ) ) {
                 carrier->add_effect( effect_cig, duration );
             } else {
                 carrier->add_effect( effect_weed_high, duration / 2 );
@@ -5588,7 +5672,7 @@ bool item::process_litcig( player *carrier, const tripoint &pos )
         }
 
         if( ( carrier->has_effect( effect_shakes ) && one_in( 10 ) ) ||
-            ( carrier->has_trait( trait_id( "JITTERY" ) ) && one_in( 200 ) ) ) {
+            ( carrier->has_trait( trait_JITTERY ) && one_in( 200 ) ) ) {
             carrier->add_msg_if_player( m_bad, _( "Your shaking hand causes you to drop your %s." ),
                                         tname().c_str() );
             g->m.add_item_or_charges( tripoint( pos.x + rng( -1, 1 ), pos.y + rng( -1, 1 ), pos.z ), *this );
@@ -5719,7 +5803,7 @@ bool item::process_tool( player *carrier, const tripoint &pos )
         qty -= ammo_consume( qty, pos );
 
         // for items in player possession if insufficient charges within tool try UPS
-        if( carrier && has_flag( "USE_UPS" ) ) {
+        if( carrier && has_flag( flag_USE_UPS ) ) {
             if( carrier->use_charges_if_avail( "UPS", qty ) ) {
                 qty = 0;
             }
@@ -5727,7 +5811,7 @@ bool item::process_tool( player *carrier, const tripoint &pos )
 
         // if insufficient available charges shutdown the tool
         if( qty > 0 ) {
-            if( carrier && has_flag( "USE_UPS" ) ) {
+            if( carrier && has_flag( flag_USE_UPS ) ) {
                 carrier->add_msg_if_player( m_info, _( "You need an UPS to run the %s!" ), tname().c_str() );
             }
 
@@ -5798,14 +5882,14 @@ bool item::process( player *carrier, const tripoint &pos, bool activate )
     if( is_corpse() && process_corpse( carrier, pos ) ) {
         return true;
     }
-    if( has_flag( "WET" ) && process_wet( carrier, pos ) ) {
+    if( has_flag( flag_WET ) && process_wet( carrier, pos ) ) {
         // Drying items are never destroyed, but we want to exit so they don't get processed as tools.
         return false;
     }
-    if( has_flag( "LITCIG" ) && process_litcig( carrier, pos ) ) {
+    if( has_flag( flag_LITCIG ) && process_litcig( carrier, pos ) ) {
         return true;
     }
-    if( has_flag( "CABLE_SPOOL" ) ) {
+    if( has_flag( flag_CABLE_SPOOL ) ) {
         // DO NOT process this as a tool! It really isn't!
         return process_cable(carrier, pos);
     }
@@ -5903,7 +5987,7 @@ std::string item::get_plant_name() const
 
 bool item::is_dangerous() const
 {
-    if( has_flag( "DANGEROUS" ) ) {
+    if( has_flag( flag_DANGEROUS ) ) {
         return true;
     }
 
@@ -5929,7 +6013,7 @@ bool item::is_soft() const
 
 bool item::is_reloadable() const
 {
-    if( has_flag( "NO_RELOAD") && !has_flag( "VEHICLE" ) ) {
+    if( has_flag( flag_NO_RELOAD) && !has_flag( flag_VEHICLE ) ) {
         return false; // turrets ignore NO_RELOAD flag
 
     } else if( is_bandolier() ) {
@@ -5950,7 +6034,6 @@ bool item::is_reloadable() const
 
 std::string item::type_name( unsigned int quantity ) const
 {
-    const auto iter = item_vars.find( "name" );
     if( corpse != nullptr && typeId() == "corpse" ) {
         if( corpse_name.empty() ) {
             return string_format( npgettext( "item name", "%s corpse",
@@ -5970,8 +6053,8 @@ std::string item::type_name( unsigned int quantity ) const
                                          "%s blood",  quantity ),
                                corpse->nname().c_str() );
         }
-    } else if( iter != item_vars.end() ) {
-        return iter->second;
+    } else if( has_var( "name" ) ) {
+        return get_var( "name" );
     } else {
         return type->nname( quantity );
     }
@@ -6049,7 +6132,7 @@ skill_id item::contextualize_skill( const skill_id &id ) const
 
 bool item::is_filthy() const
 {
-    return has_flag( "FILTHY" ) && ( get_option<bool>( "FILTHY_MORALE" ) || g->u.has_trait( trait_id( "SQUEAMISH" ) ) );
+    return has_flag( flag_FILTHY ) && ( get_option<bool>( "FILTHY_MORALE" ) || g->u.has_trait( trait_SQUEAMISH ) );
 }
 
 bool item::on_drop( const tripoint &pos )
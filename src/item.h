@@ -16,6 +16,8 @@
 #include "debug.h"
 #include "cata_utility.h"
 #include "calendar.h"
+#include "flag.h"
+#include "item_vars.h"
 
 class nc_color;
 class JsonObject;
@@ -1100,6 +1102,8 @@ public:
         double get_var( const std::string &name, double default_value ) const;
         void set_var( const std::string &name, const std::string &value );
         std::string get_var( const std::string &name, const std::string &default_value ) const;
+        /** Same as the string version, preferred in frequently called code. */
+        double get_var( const item_var_key &name, double default_value ) const;
         /** Get the variable, if it does not exists, returns an empty string. */
         std::string get_var( const std::string &name ) const;
         /** Whether the variable is defined at all. */
@@ -1123,6 +1127,8 @@ public:
          */
         /*@{*/
         bool has_flag( const std::string& flag ) const;
+        /** Same as the string version, preferred in frequently called code. */
+        bool has_flag( const flag_id &flag ) const;
         bool has_any_flag( const std::vector<std::string>& flags ) const;
 
         /** Idempotent filter setting an item specific flag. */
@@ -1631,7 +1637,7 @@ public:
     private:
         double damage_ = 0;
         const itype* curammo = nullptr;
-        std::map<std::string, std::string> item_vars;
+        item_var_map item_vars;
         const mtype* corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
@@ -1662,7 +1668,7 @@ public:
     /** What faults (if any) currently apply to this item */
     std::set<fault_id> faults;
 
- std::set<std::string> item_tags; // generic item specific flags
+ flag_set item_tags; // generic item specific flags
     unsigned item_counter = 0; // generic counter to be used with item flags
     int mission_id = -1; // Refers to a mission in game's master list
     int player_id = -1; // Only give a mission to the right player!
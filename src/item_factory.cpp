@@ -1832,7 +1832,10 @@ void Item_factory::load_basic_info( JsonObject &jo, itype &def, const std::strin
         def.explosion = load_explosion_data( je );
     }
 
-    assign( jo, "flags", def.item_tags );
+    std::set<std::string> flags = def.item_tags;
+    if( assign( jo, "flags", flags ) ) {
+        def.item_tags = flags;
+    }
 
     if( jo.has_member( "qualities" ) ) {
         set_qualities_from_json( jo, "qualities", def );
@@ -0,0 +1,307 @@
+#include "item_vars.h"
+
+#include "json.h"
+#include "string_formatter.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <locale>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace
+{
+
+/**
+ * Items on worker threads look up their variables too. The names live in fixed size chunks
+ * that are never moved or freed, so @ref item_var_key::str reads them without the lock,
+ * only interning needs it.
+ */
+struct item_var_key_table {
+    static constexpr size_t chunk_size = 256;
+    static constexpr size_t max_chunks = 256;
+
+    std::mutex mutex;
+    std::unordered_map<std::string, size_t> ids;
+    std::array<std::unique_ptr<std::array<std::string, chunk_size>>, max_chunks> chunks;
+    size_t size = 0;
+
+    item_var_key_table() {
+        // index 0 is the null key
+        add( std::string() );
+    }
+
+    const std::string &name( size_t index ) const {
+        return ( *chunks[index / chunk_size] )[index % chunk_size];
+    }
+
+    /** Requires the lock (or being the constructor). */
+    size_t add( const std::string &name ) {
+        if( size % chunk_size == 0 ) {
+            if( size / chunk_size >= max_chunks ) {
+                throw std::runtime_error( "too many distinct item variables, can not intern " + name );
+            }
+            chunks[size / chunk_size].reset( new std::array<std::string, chunk_size>() );
+        }
+        ( *chunks[size / chunk_size] )[size % chunk_size] = name;
+        ids.emplace( name, size );
+        return size++;
+    }
+};
+
+// Function local so keys with static storage can be constructed safely.
+item_var_key_table &get_key_table()
+{
+    static item_var_key_table table;
+    return table;
+}
+
+/**
+ * The names this thread looked up before. Only interned names are remembered, a name that
+ * isn't interned yet may be later on.
+ */
+std::unordered_map<std::string, size_t> &known_keys()
+{
+    static thread_local std::unordered_map<std::string, size_t> known;
+    return known;
+}
+
+std::string long_to_string( const long value )
+{
+    std::ostringstream tmpstream;
+    tmpstream.imbue( std::locale::classic() );
+    tmpstream << value;
+    return tmpstream.str();
+}
+
+std::string double_to_string( const double value )
+{
+    return string_format( "%f", value );
+}
+
+/** Parses text that is exactly the representation of an integer, as written by long_to_string. */
+bool parse_long( const std::string &text, long &value )
+{
+    if( text.empty() || text.size() > 20 ) {
+        return false;
+    }
+    const char *begin = text.c_str();
+    char *end = nullptr;
+    errno = 0;
+    value = strtol( begin, &end, 10 );
+    return errno == 0 && *end == '\0' && long_to_string( value ) == text;
+}
+
+/** Parses text that is exactly the representation of a double, as written by double_to_string. */
+bool parse_double( const std::string &text, double &value )
+{
+    if( text.empty() ) {
+        return false;
+    }
+    value = atof( text.c_str() );
+    return double_to_string( value ) == text;
+}
+
+} // namespace
+
+item_var_key::item_var_key( const std::string &name )
+{
+    if( name.empty() ) {
+        return;
+    }
+    auto &known = known_keys();
+    const auto cached = known.find( name );
+    if( cached != known.end() ) {
+        index = cached->second;
+        return;
+    }
+    item_var_key_table &table = get_key_table();
+    {
+        std::lock_guard<std::mutex> lock( table.mutex );
+        const auto iter = table.ids.find( name );
+        index = iter != table.ids.end() ? iter->second : table.add( name );
+    }
+    known.emplace( name, index );
+}
+
+item_var_key item_var_key::find( const std::string &name )
+{
+    auto &known = known_keys();
+    const auto cached = known.find( name );
+    if( cached != known.end() ) {
+        return item_var_key( cached->second );
+    }
+    item_var_key_table &table = get_key_table();
+    std::lock_guard<std::mutex> lock( table.mutex );
+    const auto iter = table.ids.find( name );
+    if( iter == table.ids.end() ) {
+        return item_var_key();
+    }
+    known.emplace( name, iter->second );
+    return item_var_key( iter->second );
+}
+
+const std::string &item_var_key::str() const
+{
+    return get_key_table().name( index );
+}
+
+bool item_var_map::entry::operator==( const entry &rhs ) const
+{
+    if( key != rhs.key || type != rhs.type ) {
+        return false;
+    }
+    switch( type ) {
+        case var_type::integer:
+            return ival == rhs.ival;
+        case var_type::floating:
+            return fval == rhs.fval;
+        case var_type::string:
+            return sval == rhs.sval;
+    }
+    return false;
+}
+
+std::string item_var_map::entry::as_string() const
+{
+    switch( type ) {
+        case var_type::integer:
+            return long_to_string( ival );
+        case var_type::floating:
+            return double_to_string( fval );
+        case var_type::string:
+            return sval;
+    }
+    return std::string();
+}
+
+const item_var_map::entry *item_var_map::find( const item_var_key &key ) const
+{
+    const auto iter = std::lower_bound( entries.begin(), entries.end(), key,
+    []( const entry & e, const item_var_key & k ) {
+        return e.key < k;
+    } );
+    return iter != entries.end() && iter->key == key ? &*iter : nullptr;
+}
+
+item_var_map::entry &item_var_map::get_or_add( const item_var_key &key )
+{
+    const auto iter = std::lower_bound( entries.begin(), entries.end(), key,
+    []( const entry & e, const item_var_key & k ) {
+        return e.key < k;
+    } );
+    if( iter != entries.end() && iter->key == key ) {
+        return *iter;
+    }
+    entry e;
+    e.key = key;
+    e.type = var_type::integer;
+    e.ival = 0;
+    return *entries.insert( iter, e );
+}
+
+bool item_var_map::has( const item_var_key &key ) const
+{
+    return find( key ) != nullptr;
+}
+
+bool item_var_map::erase( const item_var_key &key )
+{
+    const entry *e = find( key );
+    if( e == nullptr ) {
+        return false;
+    }
+    entries.erase( entries.begin() + ( e - entries.data() ) );
+    return true;
+}
+
+void item_var_map::set( const item_var_key &key, const long value )
+{
+    entry &e = get_or_add( key );
+    e.type = var_type::integer;
+    e.ival = value;
+    e.sval.clear();
+}
+
+void item_var_map::set( const item_var_key &key, const double value )
+{
+    // Round like the text representation does, so the value survives saving and loading
+    // unchanged and compares equal to a value that has the same text.
+    const std::string text = double_to_string( value );
+    entry &e = get_or_add( key );
+    e.type = var_type::floating;
+    e.fval = atof( text.c_str() );
+    e.sval.clear();
+}
+
+void item_var_map::set( const item_var_key &key, const std::string &value )
+{
+    long lval = 0;
+    double fval = 0;
+    if( parse_long( value, lval ) ) {
+        set( key, lval );
+    } else if( parse_double( value, fval ) ) {
+        entry &e = get_or_add( key );
+        e.type = var_type::floating;
+        e.fval = fval;
+        e.sval.clear();
+    } else {
+        entry &e = get_or_add( key );
+        e.type = var_type::string;
+        e.sval = value;
+    }
+}
+
+double item_var_map::get( const item_var_key &key, const double default_value ) const
+{
+    const entry *e = find( key );
+    if( e == nullptr ) {
+        return default_value;
+    }
+    switch( e->type ) {
+        case var_type::integer:
+            return e->ival;
+        case var_type::floating:
+            return e->fval;
+        case var_type::string:
+            return atof( e->sval.c_str() );
+    }
+    return default_value;
+}
+
+std::string item_var_map::get( const item_var_key &key, const std::string &default_value ) const
+{
+    const entry *e = find( key );
+    return e == nullptr ? default_value : e->as_string();
+}
+
+bool item_var_map::operator==( const item_var_map &rhs ) const
+{
+    return entries == rhs.entries;
+}
+
+void item_var_map::serialize( JsonOut &json ) const
+{
+    // Written in name order, like the std::map that was stored before.
+    std::map<std::string, std::string> sorted;
+    for( const entry &e : entries ) {
+        sorted.emplace( e.key.str(), e.as_string() );
+    }
+    json.write( sorted );
+}
+
+void item_var_map::deserialize( JsonIn &jsin )
+{
+    std::map<std::string, std::string> read_vars;
+    jsin.read( read_vars );
+    clear();
+    for( const auto &var : read_vars ) {
+        set( item_var_key( var.first ), var.second );
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+#ifndef ITEM_VARS_H
+#define ITEM_VARS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class JsonIn;
+class JsonOut;
+
+/**
+ * Interned name of an item variable. Names are interned the first time a key is
+ * constructed from them and never released, so keys can be stored in static variables.
+ * Keys can be created and used on any thread, only interning a name the thread hasn't
+ * seen before takes the table lock.
+ * The default constructed key (and the one returned by @ref find for names that were
+ * never interned) is the null key, no item can have a variable with it.
+ */
+class item_var_key
+{
+    public:
+        item_var_key() = default;
+        /** Interns the name, this may add it to the table. */
+        explicit item_var_key( const std::string &name );
+
+        /** Returns the key of an already interned name, or the null key. Never adds to the table. */
+        static item_var_key find( const std::string &name );
+
+        const std::string &str() const;
+
+        bool is_null() const {
+            return index == 0;
+        }
+
+        bool operator==( const item_var_key &rhs ) const {
+            return index == rhs.index;
+        }
+        bool operator!=( const item_var_key &rhs ) const {
+            return index != rhs.index;
+        }
+        bool operator<( const item_var_key &rhs ) const {
+            return index < rhs.index;
+        }
+
+    private:
+        explicit item_var_key( size_t index ) : index( index ) {}
+
+        size_t index = 0;
+};
+
+/**
+ * Storage for the variables of an item (see @ref item::set_var).
+ *
+ * Values are stored with their type (integer, floating point or string), so numeric
+ * values don't have to be parsed each time they are read. The observable behavior is the
+ * same as storing everything as strings: a string value that looks like a number is
+ * stored as that number, and floating point values are rounded like their "%f" text
+ * representation. Two maps are therefor equal exactly when their text representations are.
+ * Serialized as a JSON object of strings, like the plain string map used before.
+ */
+class item_var_map
+{
+    public:
+        bool empty() const {
+            return entries.empty();
+        }
+        size_t size() const {
+            return entries.size();
+        }
+        void clear() {
+            entries.clear();
+        }
+
+        bool has( const item_var_key &key ) const;
+        bool erase( const item_var_key &key );
+
+        void set( const item_var_key &key, long value );
+        void set( const item_var_key &key, double value );
+        void set( const item_var_key &key, const std::string &value );
+
+        /** Numeric value of the variable, string values are converted like `atof` does. */
+        double get( const item_var_key &key, double default_value ) const;
+        /** Text of the variable, numbers are converted to the same text that would have been stored. */
+        std::string get( const item_var_key &key, const std::string &default_value ) const;
+
+        bool operator==( const item_var_map &rhs ) const;
+        bool operator!=( const item_var_map &rhs ) const {
+            return !operator==( rhs );
+        }
+
+        void serialize( JsonOut &json ) const;
+        void deserialize( JsonIn &jsin );
+
+    private:
+        enum class var_type : char {
+            integer,
+            floating,
+            string,
+        };
+
+        struct entry {
+            item_var_key key;
+            var_type type;
+            union {
+                long ival;
+                double fval;
+            };
+            std::string sval;
+
+            bool operator==( const entry &rhs ) const;
+            std::string as_string() const;
+        };
+
+        /** Sorted by key. */
+        std::vector<entry> entries;
+
+        entry &get_or_add( const item_var_key &key );
+        const entry *find( const item_var_key &key ) const;
+};
+
+#endif
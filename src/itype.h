@@ -14,6 +14,7 @@
 #include "damage.h"
 #include "translations.h"
 #include "calendar.h"
+#include "flag.h"
 
 #include <string>
 #include <vector>
@@ -720,7 +721,7 @@ public:
     /** Fields to emit when item is in active state */
     std::set<emit_id> emits;
 
-    std::set<std::string> item_tags;
+    flag_set item_tags;
     std::set<matec_id> techniques;
 
     // Minimum stat(s) or skill(s) to use the item
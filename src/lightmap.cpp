@@ -12,6 +12,7 @@
 #include "weather.h"
 #include "vpart_position.h"
 #include "shadowcasting.h"
+#include "thread_pool.h"
 
 #include <cmath>
 #include <cstring>
@@ -62,8 +63,8 @@ void map::build_transparency_cache( const int zlev )
 
     float sight_penalty = weather_data(g->weather).sight_penalty;
 
-    // Traverse the submaps in order
-    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+    // Each column of submaps writes to its own part of the cache, they are done in parallel.
+    parallel_for( 0, my_MAPSIZE, [&]( const int smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             auto const cur_submap = get_submap_at_grid( smx, smy, zlev );
 
@@ -127,7 +128,7 @@ void map::build_transparency_cache( const int zlev )
                 }
             }
         }
-    }
+    } );
     map_cache.transparency_cache_dirty = false;
 }
 
@@ -719,7 +719,7 @@ void calc_ray_end( const int angle, const int range, const tripoint &p, tripoint
             mult = 1;
         }
 
-        if( angle <= 45 || ( 135 <= angle && angle <= 215 ) || 315 < angle ) {
+        if( angle <= 45 || ( 135 <= angle && angle <= 225 ) || 315 < angle ) {
             out.x = p.x + range * mult;
             out.y = p.y + range * tan( rad ) * mult;
         } else {
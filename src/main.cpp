@@ -447,7 +447,7 @@ int main(int argc, char *argv[])
         }
     }
 
-    srand(seed);
+    rng_set_engine_seed(seed);
 
     g = new game;
     // First load and initialize everything that does not
@@ -43,6 +43,7 @@
 #include "harvest.h"
 #include "input.h"
 #include "options.h"
+#include "thread_pool.h"
 
 #include <cmath>
 #include <stdlib.h>
@@ -196,6 +197,19 @@ void map::add_vehicle_to_cache( vehicle *veh )
 
     auto &ch = get_cache( veh->smz );
     ch.veh_in_active_range = true;
+    // Reuse the vehicle's slot if it is cached already, or a free one. Handles store slot + 1.
+    auto &vehs = ch.veh_cached_vehicles;
+    size_t slot = std::find( vehs.begin(), vehs.end(), veh ) - vehs.begin();
+    if( slot == vehs.size() ) {
+        slot = std::find( vehs.begin(), vehs.end(), nullptr ) - vehs.begin();
+    }
+    if( slot == vehs.size() ) {
+        vehs.push_back( veh );
+        ch.veh_cached_tiles.emplace_back();
+    } else {
+        vehs[slot] = veh;
+    }
+    std::vector<point> &tiles = ch.veh_cached_tiles[slot];
     // Get parts
     std::vector<vehicle_part> &parts = veh->parts;
     const tripoint gpos = veh->global_pos3();
@@ -206,10 +220,14 @@ void map::add_vehicle_to_cache( vehicle *veh )
             continue;
         }
         const tripoint p = gpos + it->precalc[0];
-        ch.veh_cached_parts.insert( std::make_pair( p,
-                                    std::make_pair( veh, partid ) ) );
-        if( inbounds( p.x, p.y ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+        if( !inbounds( p.x, p.y ) ) {
+            continue;
+        }
+        veh_part_handle &handle = ch.veh_parts_at[p.x][p.y];
+        if( handle.veh == 0 ) {
+            handle.veh = slot + 1;
+            handle.part = partid;
+            tiles.emplace_back( p.x, p.y );
         }
     }
 }
@@ -223,20 +241,17 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
 
     // Existing must be cleared
     auto &ch = get_cache( old_zlevel );
-    auto it = ch.veh_cached_parts.begin();
-    const auto end = ch.veh_cached_parts.end();
-    while( it != end ) {
-        if( it->second.first == veh ) {
-            const tripoint p = it->first;
-            if( inbounds( p.x, p.y ) ) {
-                ch.veh_exists_at[p.x][p.y] = false;
-            }
-            ch.veh_cached_parts.erase( it++ );
+    auto &vehs = ch.veh_cached_vehicles;
+    const auto found = std::find( vehs.begin(), vehs.end(), veh );
+    if( found != vehs.end() ) {
+        const size_t slot = found - vehs.begin();
+        for( const point &p : ch.veh_cached_tiles[slot] ) {
+            ch.veh_parts_at[p.x][p.y] = veh_part_handle();
             // If something was resting on vehicle, drop it
             support_dirty( tripoint( p.x, p.y, old_zlevel + 1 ) );
-        } else {
-            ++it;
         }
+        ch.veh_cached_tiles[slot].clear();
+        *found = nullptr;
     }
 
     add_vehicle_to_cache( veh );
@@ -245,14 +260,13 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
 void map::clear_vehicle_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    while( !ch.veh_cached_parts.empty() ) {
-        const auto part = ch.veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = false;
+    for( const std::vector<point> &tiles : ch.veh_cached_tiles ) {
+        for( const point &p : tiles ) {
+            ch.veh_parts_at[p.x][p.y] = veh_part_handle();
         }
-        ch.veh_cached_parts.erase( part );
     }
+    ch.veh_cached_vehicles.clear();
+    ch.veh_cached_tiles.clear();
 }
 
 void map::clear_vehicle_list( const int zlev )
@@ -296,6 +310,7 @@ std::unique_ptr<vehicle> map::detach_vehicle( vehicle *veh )
                 overmap_buffer.remove_vehicle( veh );
             }
             dirty_vehicle_list.erase(veh);
+            moving_vehicles.remove( veh );
             return std::unique_ptr<vehicle>( veh );
         }
     }
@@ -324,6 +339,7 @@ void map::vehmove()
             vehicle *veh = vehs_v.v;
             veh->gain_moves();
             veh->slow_leak();
+            moving_vehicles.update( *veh );
         }
     }
 
@@ -334,6 +350,7 @@ void map::vehmove()
             break;
         }
     }
+    moving_vehicles.clear();
     // Process item removal on the vehicles that were modified this turn.
     // Use a copy because part_removal_cleanup can modify the container.
     auto temp = dirty_vehicle_list;
@@ -345,34 +362,28 @@ void map::vehmove()
 
 bool map::vehproceed()
 {
-    VehicleList vehs = get_vehicles();
-    vehicle* cur_veh = nullptr;
-    float max_of_turn = 0;
-    tripoint pt;
-    // First horizontal movement
-    for( auto &vehs_v : vehs ) {
-        if( vehs_v.v->of_turn > max_of_turn ) {
-            cur_veh = vehs_v.v;
-            max_of_turn = cur_veh->of_turn;
-        }
+    vehicle *cur_veh = moving_vehicles.top();
+    // Vehicles left behind by a map shift are not in the reality bubble anymore
+    while( cur_veh != nullptr && get_cache( cur_veh->smz ).vehicle_list.count( cur_veh ) == 0 ) {
+        moving_vehicles.remove( cur_veh );
+        cur_veh = moving_vehicles.top();
     }
 
-    // Then vertical-only movement
     if( cur_veh == nullptr ) {
-        for( auto &vehs_v : vehs ) {
-            vehicle &cveh = *vehs_v.v;
-            if( cveh.falling ) {
-                cur_veh = vehs_v.v;
-                break;
-            }
-        }
+        return false;
     }
 
-    if( cur_veh == nullptr ) {
-        return false;
+    const bool moved = vehact( *cur_veh );
+    // The vehicle may have been destroyed, which also removes it from the queue
+    if( moving_vehicles.has( cur_veh ) ) {
+        moving_vehicles.update( *cur_veh );
     }
+    return moved;
+}
 
-    return vehact( *cur_veh );
+void map::reschedule_vehicle( vehicle &veh )
+{
+    moving_vehicles.update( veh );
 }
 
 bool map::vehact( vehicle &veh )
@@ -1014,6 +1025,8 @@ float map::vehicle_vehicle_collision( vehicle &veh, vehicle &veh2,
 
         veh.of_turn = avg_of_turn * .9;
         veh2.of_turn = avg_of_turn * 1.1;
+        // veh2 may have been parked and now needs to move during this turn
+        reschedule_vehicle( veh2 );
 
         //Energy after collision
         float E_a = 0.5 * m1 * final1.magnitude() * final1.magnitude() +
@@ -1139,20 +1152,19 @@ const vehicle* map::veh_at_internal( const tripoint &p, int &part_num ) const
 {
     // This function is called A LOT. Move as much out of here as possible.
     const auto &ch = get_cache_ref( p.z );
-    if( !ch.veh_in_active_range || !ch.veh_exists_at[p.x][p.y] ) {
+    if( !ch.veh_in_active_range ) {
         part_num = -1;
-        return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
+        return nullptr;
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
+    const veh_part_handle &handle = ch.veh_parts_at[p.x][p.y];
+    if( handle.veh == 0 ) {
+        part_num = -1;
+        return nullptr;
     }
 
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    part_num = handle.part;
+    return ch.veh_cached_vehicles[handle.veh - 1];
 }
 
 vehicle* map::veh_at_internal( const tripoint &p, int &part_num )
@@ -2289,6 +2301,8 @@ void map::drop_vehicle( const tripoint &p )
     }
 
     vp->vehicle().falling = true;
+    // Support destroyed during vehmove, let it fall in this turn still
+    reschedule_vehicle( vp->vehicle() );
 }
 
 void map::drop_fields( const tripoint &p )
@@ -4211,6 +4225,7 @@ std::list<item>::iterator map::i_rem( const tripoint &p, std::list<item>::iterat
     }
 
     current_submap->update_lum_rem(*it, lx, ly);
+    current_submap->invalidate_item_summary();
 
     return current_submap->itm[lx][ly].erase( it );
 }
@@ -4260,6 +4275,7 @@ void map::i_clear(const tripoint &p)
 
     current_submap->lum[lx][ly] = 0;
     current_submap->itm[lx][ly].clear();
+    current_submap->invalidate_item_summary();
 }
 
 item &map::spawn_an_item(const tripoint &p, item new_item,
@@ -4471,6 +4487,7 @@ item &map::add_item_at( const tripoint &p,
     current_submap->is_uniform = false;
 
     current_submap->update_lum_add(new_item, lx, ly);
+    current_submap->invalidate_item_summary();
     const auto new_pos = current_submap->itm[lx][ly].insert( index, new_item );
     if( new_item.needs_processing() ) {
         current_submap->active_items.add( new_pos, point(lx, ly) );
@@ -4680,6 +4697,10 @@ void map::process_items_in_submap( submap &current_submap,
     // If more are added as a side effect of processing, they are ignored this turn.
     // If they are destroyed before processing, they don't get processed.
     std::list<item_reference> active_items = current_submap.active_items.get();
+    if( !active_items.empty() ) {
+        // Processing may turn items into other items
+        current_submap.invalidate_item_summary();
+    }
     auto const grid_offset = point {gridp.x * SEEX, gridp.y * SEEY};
     for( auto &active_item : active_items ) {
         if( !current_submap.active_items.has( active_item ) ) {
@@ -4808,6 +4829,37 @@ bool map::has_items( const tripoint &p ) const
     return !current_submap->itm[lx][ly].empty();
 }
 
+bool map::has_items_in_radius( const tripoint &p, const int radius ) const
+{
+    if( !inbounds( p ) ) {
+        return false;
+    }
+
+    const int max = SEEX * my_MAPSIZE - 1;
+    const int min_gx = std::max( p.x - radius, 0 ) / SEEX;
+    const int max_gx = std::min( p.x + radius, max ) / SEEX;
+    const int min_gy = std::max( p.y - radius, 0 ) / SEEY;
+    const int max_gy = std::min( p.y + radius, max ) / SEEY;
+    for( int gx = min_gx; gx <= max_gx; gx++ ) {
+        for( int gy = min_gy; gy <= max_gy; gy++ ) {
+            if( get_submap_at_grid( gx, gy, p.z )->get_item_summary().count > 0 ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+const submap_item_summary &map::item_summary_at( const tripoint &p ) const
+{
+    if( !inbounds( p ) ) {
+        static const submap_item_summary nothing;
+        return nothing;
+    }
+
+    return get_submap_at( p )->get_item_summary();
+}
+
 template <typename Stack>
 std::list<item> use_amount_stack( Stack stack, const itype_id type, long &quantity )
 {
@@ -6545,7 +6597,8 @@ void map::loadn( const int gridx, const int gridy, const bool update_vehicles )
 
 // Optimized mapgen function that only works properly for very simple overmap types
 // Does not create or require a temporary map and does its own saving
-static void generate_uniform( const int x, const int y, const int z, const ter_id &terrain_type )
+static void generate_uniform( const int x, const int y, const int z, const ter_id &terrain_type,
+                              const time_point &when )
 {
     dbg( D_INFO ) << "generate_uniform x: " << x << "  y: " << y << "  abs_z: " << z
                   << "  terrain_type: " << terrain_type.id().str();
@@ -6556,18 +6609,46 @@ static void generate_uniform( const int x, const int y, const int z, const ter_i
             submap *sm = new submap();
             sm->is_uniform = true;
             std::uninitialized_fill_n( &sm->ter[0][0], block_size, terrain_type );
-            sm->last_touched = calendar::turn;
+            sm->last_touched = when;
             MAPBUFFER.add_submap( x + xd, y + yd, z, sm );
         }
     }
 }
 
-void map::loadn( const int gridx, const int gridy, const int gridz, const bool update_vehicles )
+// Generates the four submaps of an overmap terrain as of the given turn and stores them in
+// the mapbuffer. The result only depends on the world seed, the location and the turn. A quad
+// generated ahead of time by map::load_ahead is caught up to the current turn when it's
+// loaded, like any other submap that was last touched before.
+static void generate_quad( const tripoint &omt, const time_point &when )
 {
     // Cache empty overmap types
-    static const oter_id rock("empty_rock");
-    static const oter_id air("open_air");
+    static const oter_id rock( "empty_rock" );
+    static const oter_id air( "open_air" );
+
+    // Each overmap square is two nonants; to prevent overlap, generate only at
+    //  squares divisible by 2.
+    const tripoint sm = omt_to_sm_copy( omt );
+    const unsigned int seed = g->get_seed() ^ ( static_cast<unsigned int>( sm.x ) * 73856093u ) ^
+                              ( static_cast<unsigned int>( sm.y ) * 19349663u ) ^
+                              ( static_cast<unsigned int>( sm.z ) * 83492791u );
+    const rng_seed_scope seeded_rng( seed );
+
+    // Short-circuit if the map tile is uniform
+    const oter_id terrain_type = overmap_buffer.ter( omt );
+
+    // @todo: Replace with json mapgen functions.
+    if( terrain_type == air ) {
+        generate_uniform( sm.x, sm.y, sm.z, t_open_air, when );
+    } else if( terrain_type == rock ) {
+        generate_uniform( sm.x, sm.y, sm.z, t_rock, when );
+    } else {
+        tinymap tmp_map;
+        tmp_map.generate( sm.x, sm.y, sm.z, when );
+    }
+}
 
+void map::loadn( const int gridx, const int gridy, const int gridz, const bool update_vehicles )
+{
     dbg(D_INFO) << "map::loadn(game[" << g << "], worldx[" << abs_sub.x << "], worldy[" << abs_sub.y << "], gridx["
                 << gridx << "], gridy[" << gridy << "], gridz[" << gridz << "])";
 
@@ -6586,26 +6667,7 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
         // It doesn't exist; we must generate it!
         dbg( D_INFO | D_WARNING ) << "map::loadn: Missing mapbuffer data. Regenerating.";
 
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        const int newmapx = absx - ( abs( absx ) % 2 );
-        const int newmapy = absy - ( abs( absy ) % 2 );
-        // Short-circuit if the map tile is uniform
-        int overx = newmapx;
-        int overy = newmapy;
-        sm_to_omt( overx, overy );
-
-        const oter_id terrain_type = overmap_buffer.ter( overx, overy, gridz );
-
-        // @todo: Replace with json mapgen functions.
-        if( terrain_type == air ) {
-            generate_uniform( newmapx, newmapy, gridz, t_open_air );
-        } else if( terrain_type == rock ) {
-            generate_uniform( newmapx, newmapy, gridz, t_rock );
-        } else {
-            tinymap tmp_map;
-            tmp_map.generate( newmapx, newmapy, gridz, calendar::turn );
-        }
+        generate_quad( sm_to_omt_copy( tripoint( absx, absy, gridz ) ), calendar::turn );
 
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( absx, absy, gridz );
@@ -6661,6 +6723,50 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
     abs_sub.z = old_abs_z;
 }
 
+void map::load_ahead( const point &dir, const int distance, int budget )
+{
+    if( dir.x == 0 && dir.y == 0 ) {
+        return;
+    }
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    // The rows of submaps past the map edge in the direction of travel, widened so
+    // moving diagonally is covered as well.
+    const int first = -distance;
+    const int last = my_MAPSIZE + distance - 1;
+    std::vector<point> ahead;
+    // Nearest rows first, those are needed first.
+    for( int ring = 0; ring < distance; ring++ ) {
+        if( dir.x != 0 ) {
+            const int x = dir.x > 0 ? my_MAPSIZE + ring : -1 - ring;
+            for( int y = first; y <= last; y++ ) {
+                ahead.emplace_back( x, y );
+            }
+        }
+        if( dir.y != 0 ) {
+            const int y = dir.y > 0 ? my_MAPSIZE + ring : -1 - ring;
+            for( int x = first; x <= last; x++ ) {
+                ahead.emplace_back( x, y );
+            }
+        }
+    }
+    // Submaps are stored and generated in quads, each quad is handled once.
+    std::set<point> quads;
+    for( const point &grid : ahead ) {
+        const point omt = sm_to_omt_copy( abs_sub.x + grid.x, abs_sub.y + grid.y );
+        if( !quads.insert( omt ).second ) {
+            continue;
+        }
+        for( int z = zmin; z <= zmax; z++ ) {
+            const tripoint omt_z( omt.x, omt.y, z );
+            if( MAPBUFFER.prefetch_quad( omt_z ) && budget > 0 ) {
+                generate_quad( omt_z, calendar::turn );
+                budget--;
+            }
+        }
+    }
+}
+
 bool map::has_rotten_away( item &itm, const tripoint &pnt ) const
 {
     if( itm.is_corpse() ) {
@@ -7408,12 +7514,6 @@ void map::build_outside_cache( const int zlev )
         return;
     }
 
-    // Make a bigger cache to avoid bounds checking
-    // We will later copy it to our regular cache
-    const size_t padded_w = ( MAPSIZE * SEEX ) + 2;
-    const size_t padded_h = ( MAPSIZE * SEEY ) + 2;
-    bool padded_cache[padded_w][padded_h];
-
     auto &outside_cache = ch.outside_cache;
     if( zlev < 0 )
     {
@@ -7422,10 +7522,14 @@ void map::build_outside_cache( const int zlev )
         return;
     }
 
-    std::uninitialized_fill_n(
-            &padded_cache[0][0], padded_w * padded_h, true );
+    // Which tiles are indoors, found for each column of submaps in parallel.
+    // Padded by one, so the outside cache can be made without bounds checking.
+    const size_t padded_w = ( MAPSIZE * SEEX ) + 2;
+    const size_t padded_h = ( MAPSIZE * SEEY ) + 2;
+    bool indoors[padded_w][padded_h];
+    std::uninitialized_fill_n( &indoors[0][0], padded_w * padded_h, false );
 
-    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+    parallel_for( 0, my_MAPSIZE, [&]( const int smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             auto const cur_submap = get_submap_at_grid( smx, smy, zlev );
 
@@ -7433,26 +7537,30 @@ void map::build_outside_cache( const int zlev )
                 for( int sy = 0; sy < SEEY; ++sy ) {
                     if( cur_submap->get_ter( sx, sy ).obj().has_flag( TFLAG_INDOORS ) ||
                         cur_submap->get_furn( sx, sy ).obj().has_flag( TFLAG_INDOORS ) ) {
-                        const int x = sx + ( smx * SEEX );
-                        const int y = sy + ( smy * SEEY );
                         // Add 1 to both coordinates, because we're operating on the padded cache
-                        for( int dx = 0; dx <= 2; dx++ )
-                        {
-                            for( int dy = 0; dy <= 2; dy++ )
-                            {
-                                padded_cache[x + dx][y + dy] = false;
-                            }
-                        }
+                        indoors[sx + ( smx * SEEX ) + 1][sy + ( smy * SEEY ) + 1] = true;
                     }
                 }
             }
         }
-    }
+    } );
 
-    // Copy the padded cache back to the proper one, but with no padding
-    for( int x = 0; x < my_MAPSIZE * SEEX; x++ ) {
-        std::copy_n( &padded_cache[x + 1][1], my_MAPSIZE * SEEX, &outside_cache[x][0] );
-    }
+    // A tile is outside unless it or one of its neighbours is indoors.
+    parallel_for( 0, my_MAPSIZE * SEEX, [&]( const int x ) {
+        for( int y = 0; y < my_MAPSIZE * SEEY; y++ ) {
+            bool outside = true;
+            // The padded cache is offset by one, the neighbours of x,y are x..x+2, y..y+2 there
+            for( int dx = 0; dx <= 2 && outside; dx++ ) {
+                for( int dy = 0; dy <= 2; dy++ ) {
+                    if( indoors[x + dx][y + dy] ) {
+                        outside = false;
+                        break;
+                    }
+                }
+            }
+            outside_cache[x][y] = outside;
+        }
+    }, SEEX );
 
     ch.outside_cache_dirty = false;
 }
@@ -7468,7 +7576,8 @@ void map::build_floor_cache( const int zlev )
     std::uninitialized_fill_n(
             &floor_cache[0][0], ( MAPSIZE * SEEX ) * ( MAPSIZE * SEEY ), true );
 
-    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+    // Each column of submaps writes to its own part of the cache, they are done in parallel.
+    parallel_for( 0, my_MAPSIZE, [&]( const int smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             auto const cur_submap = get_submap_at_grid( smx, smy, zlev );
 
@@ -7483,7 +7592,7 @@ void map::build_floor_cache( const int zlev )
                 }
             }
         }
-    }
+    } );
 
     ch.floor_cache_dirty = false;
 }
@@ -8115,7 +8224,6 @@ level_cache::level_cache()
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, LL_DARK );
     veh_in_active_range = false;
-    std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
 }
 
 pathfinding_cache::pathfinding_cache()
@@ -2,6 +2,7 @@
 #ifndef MAP_H
 #define MAP_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <set>
@@ -18,6 +19,7 @@
 #include "string_id.h"
 #include "enums.h"
 #include "calendar.h"
+#include "vehicle_scheduler.h"
 
 //TODO: include comments about how these variables work. Where are they used. Are they constant etc.
 #define CAMPSIZE 1
@@ -53,6 +55,7 @@ class field;
 class field_entry;
 class vehicle;
 struct submap;
+struct submap_item_summary;
 class item_location;
 class map_cursor;
 struct maptile;
@@ -160,6 +163,15 @@ struct bash_params {
     bool bashed_solid; // Did we bash furniture, terrain or vehicle
 };
 
+/**
+ * Compact reference to a vehicle part, as stored in @ref level_cache::veh_parts_at.
+ * `veh` is an index into @ref level_cache::veh_cached_vehicles plus one, 0 means no vehicle.
+ */
+struct veh_part_handle {
+    uint16_t veh = 0;
+    uint16_t part = 0;
+};
+
 struct level_cache {
     level_cache(); // Zeros all relevant values
     level_cache( const level_cache &other ) = default;
@@ -180,8 +192,12 @@ struct level_cache {
     lit_level visibility_cache[MAPSIZE * SEEX][MAPSIZE * SEEY];
 
     bool veh_in_active_range;
-    bool veh_exists_at[SEEX * MAPSIZE][SEEY * MAPSIZE];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    // Vehicle part at each tile, when vehicles overlap the one cached first wins.
+    veh_part_handle veh_parts_at[SEEX * MAPSIZE][SEEY * MAPSIZE];
+    // Vehicles referenced by veh_parts_at, slots of removed vehicles are nullptr.
+    std::vector<vehicle *> veh_cached_vehicles;
+    // Tiles of veh_parts_at that point to the vehicle in the same slot of veh_cached_vehicles.
+    std::vector<std::vector<point>> veh_cached_tiles;
     std::set<vehicle *> vehicle_list;
 };
 
@@ -329,6 +345,15 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( const int sx, const int sy );
+        /**
+         * Prepares the submaps that @ref shift will load next when moving in the given
+         * direction: saved quads are read from disk in the background and missing ones
+         * are generated, so shifting doesn't have to wait for either.
+         * @param dir Direction of travel, each component is -1, 0 or 1.
+         * @param distance How many rows of submaps beyond the map edge to prepare.
+         * @param budget How many quads may be generated by this call at most.
+         */
+        void load_ahead( const point &dir, int distance, int budget );
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -486,6 +511,11 @@ class map
         void vehmove();
         // Selects a vehicle to move, returns false if no moving vehicles
         bool vehproceed();
+        /**
+         * Has to be called whenever `of_turn` or `falling` of a vehicle changes while
+         * @ref vehmove is running, so the vehicle is (re)ordered in @ref moving_vehicles.
+         */
+        void reschedule_vehicle( vehicle &veh );
         // Actually moves a vehicle
         bool vehact( vehicle &veh );
 
@@ -609,6 +639,13 @@ class map
          * Checks for existence of items. Faster than i_at(p).empty
          */
         bool has_items( const tripoint &p ) const;
+        /**
+         * Checks whether there are items on any of the submaps that overlap the square of
+         * the given radius around p, so that a search for items there can be skipped.
+         */
+        bool has_items_in_radius( const tripoint &p, int radius ) const;
+        /** What lies on the submap containing p. */
+        const submap_item_summary &item_summary_at( const tripoint &p ) const;
 
         /**
          * Calls the examine function of furniture or terrain at given tile, for given character.
@@ -1525,6 +1562,12 @@ class map
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
 
+        /**
+         * Vehicles that can still move or fall during the current @ref vehmove call.
+         * Filled at the start of @ref vehmove and consumed by @ref vehproceed.
+         */
+        vehicle_scheduler moving_vehicles;
+
         // Note: no bounds check
         level_cache &get_cache( int zlev ) {
             return *caches[zlev + OVERMAP_DEPTH];
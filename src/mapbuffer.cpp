@@ -15,14 +15,44 @@
 #include "vehicle.h"
 #include "submap.h"
 #include "computer.h"
+#include "thread_pool.h"
 
+#include <chrono>
+#include <fstream>
 #include <sstream>
 
 #define dbg(x) DebugLog((DebugLevel)(x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
 
 mapbuffer MAPBUFFER;
 
-mapbuffer::mapbuffer()
+// Quads that are prefetched but never looked up are dropped when there are more than this.
+static constexpr size_t max_prefetched_quads = 256;
+// Reads queued for the workers at the same time, more are started on later calls.
+static constexpr int max_running_reads = 8;
+
+static std::string quad_file_path( const tripoint &om_addr )
+{
+    const tripoint segment_addr = omt_to_seg_copy( om_addr );
+    std::stringstream quad_path;
+    quad_path << g->get_world_base_save_path() << "/maps/" <<
+              segment_addr.x << "." << segment_addr.y << "." << segment_addr.z << "/" <<
+              om_addr.x << "." << om_addr.y << "." << om_addr.z << ".map";
+    return quad_path.str();
+}
+
+// Runs on a worker thread, must not touch anything but the file.
+static std::string read_quad_file( const std::string &path )
+{
+    std::ifstream fin( path.c_str(), std::ios::binary );
+    if( !fin.is_open() ) {
+        return std::string();
+    }
+    std::ostringstream content;
+    content << fin.rdbuf();
+    return content.str();
+}
+
+mapbuffer::mapbuffer() : running_reads( 0 )
 {
 }
 
@@ -33,6 +63,7 @@ mapbuffer::~mapbuffer()
 
 void mapbuffer::reset()
 {
+    discard_prefetched();
     for( auto &elem : submaps ) {
         delete elem.second;
     }
@@ -102,6 +133,9 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
 
 void mapbuffer::save( bool delete_after_save )
 {
+    // Saving may rewrite quads that have been read before.
+    discard_prefetched();
+
     std::stringstream map_directory;
     map_directory << g->get_world_base_save_path() << "/maps";
     assure_dir_exist( map_directory.str() );
@@ -397,26 +431,81 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
 {
     // Map the tripoint to the submap quad that stores it.
     const tripoint om_addr = sm_to_omt_copy( p );
-    const tripoint segment_addr = omt_to_seg_copy( om_addr );
-    std::stringstream quad_path;
-    quad_path << g->get_world_base_save_path() << "/maps/" <<
-              segment_addr.x << "." << segment_addr.y << "." << segment_addr.z << "/" <<
-              om_addr.x << "." << om_addr.y << "." << om_addr.z << ".map";
-
-    using namespace std::placeholders;
-    if( !read_from_file_optional_json( quad_path.str(),
-                                       std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
-        // If it doesn't exist, trigger generating it.
-        return NULL;
+    const std::string quad_path = quad_file_path( om_addr );
+
+    const auto prefetch = prefetched.find( om_addr );
+    if( prefetch != prefetched.end() ) {
+        // Waits for the read if it is still running.
+        const std::string content = prefetch->second.get();
+        prefetched.erase( prefetch );
+        if( content.empty() ) {
+            return NULL;
+        }
+        std::istringstream fin( content );
+        JsonIn jsin( fin );
+        deserialize( jsin );
+    } else {
+        using namespace std::placeholders;
+        if( !read_from_file_optional_json( quad_path,
+                                           std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
+            // If it doesn't exist, trigger generating it.
+            return NULL;
+        }
     }
     if( submaps.count( p ) == 0 ) {
         debugmsg( "file %s did not contain the expected submap %d,%d,%d",
-                  quad_path.str().c_str(), p.x, p.y, p.z );
+                  quad_path.c_str(), p.x, p.y, p.z );
         return NULL;
     }
     return submaps[ p ];
 }
 
+bool mapbuffer::prefetch_quad( const tripoint &om_addr )
+{
+    const auto iter = prefetched.find( om_addr );
+    const bool ready = iter != prefetched.end() &&
+                       iter->second.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready;
+    if( submaps.count( omt_to_sm_copy( om_addr ) ) != 0 ) {
+        // Already loaded (or generated), the file content is of no use anymore.
+        if( ready ) {
+            prefetched.erase( iter );
+        }
+        return false;
+    }
+    if( iter == prefetched.end() ) {
+        const std::string path = quad_file_path( om_addr );
+        if( !file_exist( path ) ) {
+            return true;
+        }
+        // Without workers the read would block the main thread, loadn reads it when needed.
+        if( running_reads >= max_running_reads || parallel_thread_count() == 1 ) {
+            return false;
+        }
+        if( prefetched.size() >= max_prefetched_quads ) {
+            discard_prefetched();
+        }
+        const auto read = std::make_shared<std::packaged_task<std::string()>>(
+                              std::bind( read_quad_file, path ) );
+        prefetched.emplace( om_addr, read->get_future().share() );
+        running_reads++;
+        std::atomic<int> *const running = &running_reads;
+        run_in_background( [read, running]() {
+            ( *read )();
+            ( *running )--;
+        } );
+        return false;
+    }
+    return ready && iter->second.get().empty();
+}
+
+void mapbuffer::discard_prefetched()
+{
+    for( auto &elem : prefetched ) {
+        elem.second.wait();
+    }
+    prefetched.clear();
+}
+
 void mapbuffer::deserialize( JsonIn &jsin )
 {
     jsin.start_array();
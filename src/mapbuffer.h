@@ -2,6 +2,8 @@
 #ifndef MAPBUFFER_H
 #define MAPBUFFER_H
 
+#include <atomic>
+#include <future>
 #include <map>
 #include <list>
 #include <memory>
@@ -56,6 +58,20 @@ class mapbuffer
         submap *lookup_submap( int x, int y, int z );
         submap *lookup_submap( const tripoint &p );
 
+        /**
+         * Starts reading the file of a quad of submaps on a worker thread, so a later
+         * @ref lookup_submap of one of them only has to parse it.
+         * Can be called repeatedly, the read is only started once. Only a few reads are
+         * queued at a time, and none when there are no worker threads.
+         *
+         * @param om_addr The quad, in overmap terrain coordinates.
+         * @return true if the quad is neither in the buffer nor saved, so it has to
+         * be generated. False if it's available, or if it's still being read.
+         */
+        bool prefetch_quad( const tripoint &om_addr );
+        /** Forgets all prefetched quads, waits for reads that are still running. */
+        void discard_prefetched();
+
     private:
         typedef std::map<tripoint, submap *> submap_map_t;
 
@@ -77,6 +93,13 @@ class mapbuffer
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                         bool delete_after_save );
         submap_map_t submaps;
+        /**
+         * Content of quad files that are read in the background, indexed by the quad
+         * (overmap terrain coordinates). An empty string means there is no such file.
+         */
+        std::map<tripoint, std::shared_future<std::string>> prefetched;
+        /** Reads of @ref prefetched that have not finished yet. */
+        std::atomic<int> running_reads;
 };
 
 extern mapbuffer MAPBUFFER;
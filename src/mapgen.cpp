@@ -198,6 +198,10 @@ void map::generate( const int x, const int y, const int z, const time_point &whe
 
             if( i <= 1 && j <= 1 ) {
                 saven( i, j, z );
+                // Generated as of that turn, even if it is before the current one
+                if( submap *const sm = get_submap_at_grid( i, j, z ) ) {
+                    sm->last_touched = when;
+                }
             } else {
                 delete get_submap_at_grid( i, j, z );
             }
@@ -5824,7 +5828,7 @@ $$$$-|-|=HH-|-HHHH-|####\n",
         for(int a = 0; a < 21; a++ ) {
             vset.push_back(a);
         }
-        std::random_shuffle(vset.begin(), vset.end());
+        rng_shuffle(vset.begin(), vset.end());
         for(int a = 0; a < vnum; a++) {
             if (vset[a] < 12) {
                 if (one_in(2)) {
@@ -1,4 +1,5 @@
 #include "mongroup.h"
+#include <algorithm>
 #include <vector>
 
 #include "rng.h"
@@ -416,3 +417,128 @@ const mtype_id &MonsterGroupManager::GetRandomMonsterFromGroup( const mongroup_i
 
     return group.defaultMonster;
 }
+
+constexpr int mongroup_map::cell_size;
+
+tripoint mongroup_map::cell_of( const tripoint &pos )
+{
+    // Rounds towards negative infinity, groups can be outside of their overmap.
+    const auto div = []( const int v ) {
+        return v >= 0 ? v / cell_size : ( v - cell_size + 1 ) / cell_size;
+    };
+    return tripoint( div( pos.x ), div( pos.y ), pos.z );
+}
+
+mongroup &mongroup_map::insert( const mongroup &group )
+{
+    std::list<mongroup> &cell = cells[cell_of( group.pos )];
+    cell.push_back( group );
+    count++;
+    return cell.back();
+}
+
+mongroup_map::iterator mongroup_map::erase( iterator it )
+{
+    iterator next = it;
+    ++next;
+    it.cell->second.erase( it.group );
+    count--;
+    // Iteration relies on cells never being empty. The next group is in another cell
+    // then, its iterator is not affected.
+    if( it.cell->second.empty() ) {
+        cells.erase( it.cell );
+    }
+    return next;
+}
+
+void mongroup_map::move( mongroup &group, const tripoint &pos )
+{
+    const tripoint old_cell_pos = cell_of( group.pos );
+    const tripoint new_cell_pos = cell_of( pos );
+    group.pos = pos;
+    if( old_cell_pos == new_cell_pos ) {
+        return;
+    }
+    const auto old_cell = cells.find( old_cell_pos );
+    if( old_cell == cells.end() ) {
+        debugmsg( "monster group at %d,%d,%d is not stored here", pos.x, pos.y, pos.z );
+        return;
+    }
+    std::list<mongroup> &old_groups = old_cell->second;
+    const auto iter = std::find_if( old_groups.begin(), old_groups.end(), [&group]( const mongroup & g ) {
+        return &g == &group;
+    } );
+    if( iter == old_groups.end() ) {
+        debugmsg( "monster group at %d,%d,%d is not stored here", pos.x, pos.y, pos.z );
+        return;
+    }
+    std::list<mongroup> &new_groups = cells[new_cell_pos];
+    new_groups.splice( new_groups.end(), old_groups, iter );
+    if( old_groups.empty() ) {
+        cells.erase( old_cell );
+    }
+}
+
+std::vector<mongroup *> mongroup_map::groups_at( const tripoint &pos )
+{
+    std::vector<mongroup *> result;
+    const auto cell = cells.find( cell_of( pos ) );
+    if( cell != cells.end() ) {
+        for( mongroup &group : cell->second ) {
+            if( group.pos == pos ) {
+                result.push_back( &group );
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<const mongroup *> mongroup_map::groups_at( const tripoint &pos ) const
+{
+    std::vector<const mongroup *> result;
+    const auto cell = cells.find( cell_of( pos ) );
+    if( cell != cells.end() ) {
+        for( const mongroup &group : cell->second ) {
+            if( group.pos == pos ) {
+                result.push_back( &group );
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<mongroup *> mongroup_map::groups_near( const tripoint &pos, const int distance )
+{
+    std::vector<mongroup *> result;
+    const tripoint min_cell = cell_of( pos - tripoint( distance, distance, distance ) );
+    const tripoint max_cell = cell_of( pos + tripoint( distance, distance, distance ) );
+    // Both visit the cells in the same order as iterating over all of them does.
+    const auto add_cell = [&]( std::list<mongroup> &groups ) {
+        for( mongroup &group : groups ) {
+            result.push_back( &group );
+        }
+    };
+    const long area = static_cast<long>( max_cell.x - min_cell.x + 1 ) *
+                      ( max_cell.y - min_cell.y + 1 ) * ( max_cell.z - min_cell.z + 1 );
+    if( area > static_cast<long>( cells.size() ) ) {
+        for( auto &cell : cells ) {
+            const tripoint &c = cell.first;
+            if( c.x >= min_cell.x && c.x <= max_cell.x && c.y >= min_cell.y && c.y <= max_cell.y &&
+                c.z >= min_cell.z && c.z <= max_cell.z ) {
+                add_cell( cell.second );
+            }
+        }
+        return result;
+    }
+    for( int x = min_cell.x; x <= max_cell.x; x++ ) {
+        for( int y = min_cell.y; y <= max_cell.y; y++ ) {
+            for( int z = min_cell.z; z <= max_cell.z; z++ ) {
+                const auto cell = cells.find( tripoint( x, y, z ) );
+                if( cell != cells.end() ) {
+                    add_cell( cell->second );
+                }
+            }
+        }
+    }
+    return result;
+}
@@ -3,6 +3,7 @@
 #define MONGROUP_H
 
 #include <vector>
+#include <list>
 #include <map>
 #include <set>
 #include <string>
@@ -162,6 +163,130 @@ struct mongroup {
     void serialize( JsonOut &jsout ) const;
 };
 
+/**
+ * The monster groups of an overmap, bucketed by their position into cells of
+ * @ref cell_size x @ref cell_size submaps. Groups near a point can be found without
+ * looking at all of them, and moving a group to another cell doesn't copy it.
+ * References to stored groups stay valid until the group is erased.
+ * Iteration visits the cells in order, and the groups of a cell in the order they were
+ * added to it.
+ * The position of a stored group must only be changed with @ref move, so it stays in
+ * the right cell.
+ */
+class mongroup_map
+{
+    private:
+        using cell_map = std::map<tripoint, std::list<mongroup>>;
+
+        template<typename CellIter, typename GroupIter, typename T>
+        class iterator_t
+        {
+            public:
+                iterator_t() = default;
+                iterator_t( CellIter cell, CellIter cells_end ) : cell( cell ), cells_end( cells_end ) {
+                    if( cell != cells_end ) {
+                        group = cell->second.begin();
+                    }
+                }
+                iterator_t( CellIter cell, CellIter cells_end, GroupIter group ) :
+                    cell( cell ), cells_end( cells_end ), group( group ) {}
+                // The group of the end iterator is singular (or belonged to an erased cell),
+                // it must not be copied, checked standard libraries reject that.
+                iterator_t( const iterator_t &rhs ) : cell( rhs.cell ), cells_end( rhs.cells_end ) {
+                    if( cell != cells_end ) {
+                        group = rhs.group;
+                    }
+                }
+                iterator_t &operator=( const iterator_t &rhs ) {
+                    cell = rhs.cell;
+                    cells_end = rhs.cells_end;
+                    if( cell != cells_end ) {
+                        group = rhs.group;
+                    }
+                    return *this;
+                }
+
+                T &operator*() const {
+                    return *group;
+                }
+                T *operator->() const {
+                    return &*group;
+                }
+                iterator_t &operator++() {
+                    // Cells are never empty, see mongroup_map::erase
+                    if( ++group == cell->second.end() && ++cell != cells_end ) {
+                        group = cell->second.begin();
+                    }
+                    return *this;
+                }
+                bool operator==( const iterator_t &rhs ) const {
+                    return cell == rhs.cell && ( cell == cells_end || group == rhs.group );
+                }
+                bool operator!=( const iterator_t &rhs ) const {
+                    return !operator==( rhs );
+                }
+
+            private:
+                friend class mongroup_map;
+
+                CellIter cell;
+                CellIter cells_end;
+                GroupIter group;
+        };
+
+    public:
+        using iterator = iterator_t<cell_map::iterator, std::list<mongroup>::iterator, mongroup>;
+        using const_iterator = iterator_t<cell_map::const_iterator, std::list<mongroup>::const_iterator, const mongroup>;
+
+        /** Edge length of the cells in submaps. */
+        static constexpr int cell_size = 12;
+
+        iterator begin() {
+            return iterator( cells.begin(), cells.end() );
+        }
+        iterator end() {
+            return iterator( cells.end(), cells.end() );
+        }
+        const_iterator begin() const {
+            return const_iterator( cells.begin(), cells.end() );
+        }
+        const_iterator end() const {
+            return const_iterator( cells.end(), cells.end() );
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+        size_t size() const {
+            return count;
+        }
+        void clear() {
+            cells.clear();
+            count = 0;
+        }
+
+        mongroup &insert( const mongroup &group );
+        /** @return The iterator to the group after the erased one. */
+        iterator erase( iterator it );
+        /** Changes the position of a stored group. */
+        void move( mongroup &group, const tripoint &pos );
+
+        /** Groups at exactly that position. */
+        std::vector<mongroup *> groups_at( const tripoint &pos );
+        std::vector<const mongroup *> groups_at( const tripoint &pos ) const;
+        /**
+         * Groups that may be within the distance of the position on any axis, including
+         * the z-axis. Contains some that are further away, callers check the actual distance.
+         */
+        std::vector<mongroup *> groups_near( const tripoint &pos, int distance );
+
+    private:
+        static tripoint cell_of( const tripoint &pos );
+
+        cell_map cells;
+        size_t count = 0;
+};
+
 class MonsterGroupManager
 {
     public:
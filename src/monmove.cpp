@@ -21,6 +21,7 @@
 #include "mtype.h"
 #include "field.h"
 #include "scent_map.h"
+#include "world_snapshot.h"
 
 #include <stdlib.h>
 //Used for e^(x) functions
@@ -194,6 +195,211 @@ float monster::rate_target( Creature &c, float best, bool smart ) const
     return INT_MAX;
 }
 
+float monster::rate_target( const world_snapshot &world, const creature_state &c, float best,
+                           bool smart ) const
+{
+    const int d = rl_dist( pos(), c.pos );
+    if( d <= 0 || c.who == this ) {
+        return INT_MAX;
+    }
+
+    // Check a very common and cheap case first
+    if( !smart && d >= best ) {
+        return INT_MAX;
+    }
+
+    if( !world.sees( *this, c ) ) {
+        return INT_MAX;
+    }
+
+    if( !smart ) {
+        return d;
+    }
+
+    float power = c.power_rating;
+    // Their attitude to us and not ours to them, so that bobcats won't get gunned down
+    if( c.is_monster && monster::attitude_between( c.faction, c.friendly, c.morale, c.anger,
+            faction, friendly ) == Attitude::A_HOSTILE ) {
+        power += 2;
+    }
+
+    if( power > 0 ) {
+        return d / power;
+    }
+
+    return INT_MAX;
+}
+
+monster_intent monster::plan_intent( const world_snapshot &world ) const
+{
+    monster_intent intent;
+    // Bots are more intelligent than most living stuff
+    bool smart_planning = has_flag( MF_PRIORITIZE_TARGETS );
+    const creature_state *target = nullptr;
+    // 8.6f is rating for tank drone 60 tiles away, moose 16 or boomer 33
+    float dist = !smart_planning ? 1000 : 8.6f;
+    bool fleeing = false;
+    bool wandering = wandf > 0;
+    bool docile = friendly != 0 && has_effect( effect_docile );
+    bool angers_hostile_weak = type->anger.find( MTRIG_HOSTILE_WEAK ) != type->anger.end();
+    int angers_hostile_near =
+        ( type->anger.find( MTRIG_HOSTILE_CLOSE ) != type->anger.end() ) ? 5 : 0;
+    int fears_hostile_near = ( type->fear.find( MTRIG_HOSTILE_CLOSE ) != type->fear.end() ) ? 5 : 0;
+    bool group_morale = has_flag( MF_GROUP_MORALE ) && morale < type->morale;
+    bool swarms = has_flag( MF_SWARMS );
+    auto mood = attitude();
+    const creature_state &u = world.u;
+
+    // If we can see the player, move toward them or flee, simpleminded animals are too dumb to follow the player.
+    if( friendly == 0 && world.sees( *this, u ) && !has_flag( MF_PET_WONT_FOLLOW ) ) {
+        dist = rate_target( world, u, dist, smart_planning );
+        fleeing = fleeing || is_fleeing( u );
+        target = &u;
+        if( dist <= 5 ) {
+            intent.anger += angers_hostile_near;
+            intent.morale -= fears_hostile_near;
+        }
+    } else if( friendly != 0 && !docile ) {
+        // Target unfriendly monsters, only if we aren't interacting with the player.
+        for( const creature_state &tmp : world.monsters ) {
+            if( tmp.friendly == 0 && !tmp.dead ) {
+                float rating = rate_target( world, tmp, dist, smart_planning );
+                if( rating < dist ) {
+                    target = &tmp;
+                    dist = rating;
+                }
+            }
+        }
+    }
+
+    if( docile ) {
+        if( friendly != 0 && target != nullptr ) {
+            intent.dest = target->pos;
+        }
+
+        return intent;
+    }
+
+    for( const creature_state &who : world.npcs ) {
+        auto faction_att = faction.obj().attitude( who.faction );
+        if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
+            continue;
+        }
+
+        float rating = rate_target( world, who, dist, smart_planning );
+        bool fleeing_from = is_fleeing( who );
+        // Switch targets if closer and hostile or scarier than current target
+        if( ( rating < dist && fleeing ) ||
+            ( rating < dist && attitude( who.traits ) == MATT_ATTACK ) ||
+            ( !fleeing && fleeing_from ) ) {
+            target = &who;
+            dist = rating;
+        }
+        fleeing = fleeing || fleeing_from;
+        if( rating <= 5 ) {
+            intent.anger += angers_hostile_near;
+            intent.morale -= fears_hostile_near;
+        }
+    }
+
+    fleeing = fleeing || ( mood == MATT_FLEE );
+    if( friendly == 0 ) {
+        for( const auto &fac : world.factions ) {
+            auto faction_att = faction.obj().attitude( fac.first );
+            if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
+                continue;
+            }
+
+            for( const creature_state *const mon : fac.second ) {
+                float rating = rate_target( world, *mon, dist, smart_planning );
+                if( rating < dist ) {
+                    target = mon;
+                    dist = rating;
+                }
+                if( rating <= 5 ) {
+                    intent.anger += angers_hostile_near;
+                    intent.morale -= fears_hostile_near;
+                }
+            }
+        }
+    }
+
+    // Friendly monsters here
+    // Avoid for hordes of same-faction stuff or it could get expensive
+    const auto actual_faction = friendly == 0 ? faction : world.player_faction;
+    auto const &myfaction_iter = world.factions.find( actual_faction );
+    if( myfaction_iter == world.factions.end() ) {
+        // Nobody of our faction was around when the snapshot was taken
+        swarms = false;
+        group_morale = false;
+    }
+    swarms = swarms && target == nullptr; // Only swarm if we have no target
+    if( group_morale || swarms ) {
+        for( const creature_state *const mon : myfaction_iter->second ) {
+            float rating = rate_target( world, *mon, dist, smart_planning );
+            if( group_morale && rating <= 10 ) {
+                intent.morale += 10 - rating;
+            }
+            if( swarms ) {
+                if( rating < 5 ) { // Too crowded here
+                    intent.wander = point( posx() * rng( 1, 3 ) - mon->pos.x,
+                                           posy() * rng( 1, 3 ) - mon->pos.y );
+                    wandering = true;
+                    target = nullptr;
+                    // Swarm to the furthest ally you can see
+                } else if( rating < INT_MAX && rating > dist && !wandering ) {
+                    target = mon;
+                    dist = rating;
+                }
+            }
+        }
+    }
+
+    if( target != nullptr ) {
+
+        tripoint dest = target->pos;
+        auto att_to_target = world.attitude_to( *this, *target );
+        if( att_to_target == Attitude::A_HOSTILE && !fleeing ) {
+            intent.dest = dest;
+        } else if( fleeing ) {
+            intent.dest = tripoint( posx() * 2 - dest.x, posy() * 2 - dest.y, posz() );
+        }
+        if( angers_hostile_weak && att_to_target != Attitude::A_FRIENDLY ) {
+            int hp_per = target->hp_percentage;
+            if( hp_per <= 70 ) {
+                intent.anger += 10 - int( hp_per / 10 );
+            }
+        }
+    } else if( friendly > 0 && one_in( 3 ) ) {
+        // Grow restless with no targets
+        intent.friendly--;
+    } else if( friendly < 0 && world.sees( *this, u ) ) {
+        if( rl_dist( pos(), u.pos ) > 2 ) {
+            intent.dest = u.pos;
+        } else {
+            intent.unset_dest = true;
+        }
+    }
+    return intent;
+}
+
+void monster::apply_intent( const monster_intent &intent )
+{
+    anger += intent.anger;
+    morale += intent.morale;
+    friendly += intent.friendly;
+    if( intent.wander ) {
+        wander_pos.x = intent.wander->x;
+        wander_pos.y = intent.wander->y;
+        wandf = 2;
+    }
+    if( intent.dest ) {
+        set_dest( *intent.dest );
+    } else if( intent.unset_dest ) {
+        unset_dest();
+    }
+}
+
 void monster::plan( const mfactions &factions )
 {
     // Bots are more intelligent than most living stuff
@@ -33,6 +33,7 @@
 #include "field.h"
 #include "sounds.h"
 #include "npc.h"
+#include "world_snapshot.h"
 
 // Limit the number of iterations for next upgrade_time calculations.
 // This also sets the percentage of monsters that will never upgrade.
@@ -127,6 +128,16 @@ static const trait_id trait_PACIFIST( "PACIFIST" );
 static const trait_id trait_PHEROMONE_INSECT( "PHEROMONE_INSECT" );
 static const trait_id trait_PHEROMONE_MAMMAL( "PHEROMONE_MAMMAL" );
 static const trait_id trait_TERRIFYING( "TERRIFYING" );
+static const trait_id trait_THRESH_MYCUS( "THRESH_MYCUS" );
+
+static const material_id mat_bone( "bone" );
+static const material_id mat_flesh( "flesh" );
+static const material_id mat_hflesh( "hflesh" );
+static const material_id mat_iflesh( "iflesh" );
+static const material_id mat_iron( "iron" );
+static const material_id mat_steel( "steel" );
+static const material_id mat_stone( "stone" );
+static const material_id mat_veggy( "veggy" );
 
 static const std::map<m_size, std::string> size_names {
     {m_size::MS_TINY, translate_marker( "tiny" )},
@@ -353,12 +364,12 @@ std::string monster::name_with_armor() const
     std::string ret;
     if( type->in_species( INSECT ) ) {
         ret = string_format(_("carapace"));
-    } else if( made_of( material_id( "veggy" ) ) ) {
+    } else if( made_of( mat_veggy ) ) {
         ret = string_format(_("thick bark"));
-    } else if( made_of( material_id( "flesh" ) ) || made_of( material_id( "hflesh" ) ) ||
-               made_of( material_id( "iflesh" ) ) ) {
+    } else if( made_of( mat_flesh ) || made_of( mat_hflesh ) ||
+               made_of( mat_iflesh ) ) {
         ret = string_format(_("thick hide"));
-    } else if( made_of( material_id( "iron" ) ) || made_of( material_id( "steel" ) )) {
+    } else if( made_of( mat_iron ) || made_of( mat_steel )) {
         ret = string_format(_("armor plating"));
     }
     return ret;
@@ -682,6 +693,15 @@ bool monster::is_fleeing(player &u) const
     return (att == MATT_FLEE || (att == MATT_FOLLOW && rl_dist( pos(), u.pos() ) <= 4));
 }
 
+bool monster::is_fleeing( const creature_state &u ) const
+{
+    if( effect_cache[FLEEING] ) {
+        return true;
+    }
+    monster_attitude att = attitude( u.traits );
+    return ( att == MATT_FLEE || ( att == MATT_FOLLOW && rl_dist( pos(), u.pos ) <= 4 ) );
+}
+
 Creature::Attitude monster::attitude_to( const Creature &other ) const
 {
     const auto m = dynamic_cast<const monster *>( &other );
@@ -691,52 +711,83 @@ Creature::Attitude monster::attitude_to( const Creature &other ) const
             return A_FRIENDLY;
         }
 
-        auto faction_att = faction.obj().attitude( m->faction );
-        if( ( friendly != 0 && m->friendly != 0 ) ||
-            ( friendly == 0 && m->friendly == 0 && faction_att == MFA_FRIENDLY ) ) {
-            // Friendly (to player) monsters are friendly to each other
-            // Unfriendly monsters go by faction attitude
+        return attitude_between( faction, friendly, morale, anger, m->faction, m->friendly );
+    } else if( p != nullptr ) {
+        return attitude_for( attitude( const_cast<player *>( p ) ) );
+    }
+    // Should not happen!, creature should be either player or monster
+    return A_NEUTRAL;
+}
+
+Creature::Attitude monster::attitude_between( const mfaction_id &faction, const int friendly,
+        const int morale, const int anger, const mfaction_id &other_faction, const int other_friendly )
+{
+    auto faction_att = faction.obj().attitude( other_faction );
+    if( ( friendly != 0 && other_friendly != 0 ) ||
+        ( friendly == 0 && other_friendly == 0 && faction_att == MFA_FRIENDLY ) ) {
+        // Friendly (to player) monsters are friendly to each other
+        // Unfriendly monsters go by faction attitude
+        return A_FRIENDLY;
+    } else if( ( friendly == 0 && other_friendly == 0 && faction_att == MFA_NEUTRAL ) ||
+               morale < 0 || anger < 10 ) {
+        // Stuff that won't attack is neutral to everything
+        return A_NEUTRAL;
+    } else {
+        return A_HOSTILE;
+    }
+}
+
+Creature::Attitude monster::attitude_for( const monster_attitude att )
+{
+    switch( att ) {
+        case MATT_FRIEND:
+        case MATT_ZLAVE:
             return A_FRIENDLY;
-        } else if( ( friendly == 0 && m->friendly == 0 && faction_att == MFA_NEUTRAL ) ||
-                     morale < 0 || anger < 10 ) {
-            // Stuff that won't attack is neutral to everything
+        case MATT_FPASSIVE:
+        case MATT_FLEE:
+        case MATT_IGNORE:
+        case MATT_FOLLOW:
             return A_NEUTRAL;
-        } else {
+        case MATT_ATTACK:
             return A_HOSTILE;
-        }
-    } else if( p != nullptr ) {
-        switch( attitude( const_cast<player *>( p ) ) ) {
-            case MATT_FRIEND:
-            case MATT_ZLAVE:
-                return A_FRIENDLY;
-            case MATT_FPASSIVE:
-            case MATT_FLEE:
-            case MATT_IGNORE:
-            case MATT_FOLLOW:
-                return A_NEUTRAL;
-            case MATT_ATTACK:
-                return A_HOSTILE;
-            case MATT_NULL:
-            case NUM_MONSTER_ATTITUDES:
-                break;
-        }
+        case MATT_NULL:
+        case NUM_MONSTER_ATTITUDES:
+            break;
     }
-    // Should not happen!, creature should be either player or monster
     return A_NEUTRAL;
 }
 
+attitude_traits::attitude_traits( const Character &u )
+{
+    is_player = &u == &g->u;
+    // Zombies don't understand not attacking NPCs, but dogs and bots should.
+    const npc *np = dynamic_cast< const npc * >( &u );
+    peaceful_npc = np != nullptr && np->get_attitude() != NPCATT_KILL;
+    bee = u.has_trait( trait_BEE );
+    flowers = u.has_trait( trait_FLOWERS );
+    mycus_thresh = u.has_trait( trait_THRESH_MYCUS );
+    pheromone_mammal = u.has_trait( trait_PHEROMONE_MAMMAL );
+    pheromone_insect = u.has_trait( trait_PHEROMONE_INSECT );
+    terrifying = u.has_trait( trait_TERRIFYING );
+    animal_empath = u.has_trait( trait_ANIMALEMPATH );
+    animal_discord = u.has_trait( trait_ANIMALDISCORD );
+}
+
 monster_attitude monster::attitude( const Character *u ) const
+{
+    return u == nullptr ? attitude( attitude_traits() ) : attitude( attitude_traits( *u ) );
+}
+
+monster_attitude monster::attitude( const attitude_traits &u ) const
 {
     if( friendly != 0 ) {
         if( has_effect( effect_docile ) ) {
             return MATT_FPASSIVE;
         }
-        if( u == &g->u ) {
+        if( u.is_player ) {
             return MATT_FRIEND;
         }
-        // Zombies don't understand not attacking NPCs, but dogs and bots should.
-        const npc *np = dynamic_cast< const npc * >( u );
-        if( np != nullptr && np->get_attitude() != NPCATT_KILL && !type->in_species( ZOMBIE ) ) {
+        if( u.peaceful_npc && !type->in_species( ZOMBIE ) ) {
             return MATT_FRIEND;
         }
     }
@@ -750,49 +801,42 @@ monster_attitude monster::attitude( const Character *u ) const
     int effective_anger  = anger;
     int effective_morale = morale;
 
-    if( u != nullptr ) {
-        // Those are checked quite often, so avoiding string construction is a good idea
-        const string_id<monfaction> faction_bee( "bee" );
-        const trait_id pheromone_mammal( "PHEROMONE_MAMMAL" );
-        const trait_id pheromone_insect( "PHEROMONE_INSECT" );
-        const trait_id mycus_thresh( "THRESH_MYCUS" );
-        const trait_id terrifying( "TERRIFYING" );
-        if( faction == faction_bee ) {
-            if( u->has_trait( trait_BEE ) ) {
-                return MATT_FRIEND;
-            } else if( u->has_trait( trait_FLOWERS ) ) {
-                effective_anger -= 10;
-            }
-        }
-
-        if( type->in_species( FUNGUS ) && u->has_trait( mycus_thresh ) ) {
+    // Those are checked quite often, so avoiding string construction is a good idea
+    static const string_id<monfaction> faction_bee( "bee" );
+    if( faction == faction_bee ) {
+        if( u.bee ) {
             return MATT_FRIEND;
+        } else if( u.flowers ) {
+            effective_anger -= 10;
         }
+    }
 
-        if( effective_anger >= 10 &&
-            ( (type->in_species( MAMMAL ) && u->has_trait( pheromone_mammal ) ) ||
-              (type->in_species( INSECT ) && u->has_trait( pheromone_insect ) ) ) ) {
-            effective_anger -= 20;
-        }
+    if( type->in_species( FUNGUS ) && u.mycus_thresh ) {
+        return MATT_FRIEND;
+    }
 
+    if( effective_anger >= 10 &&
+        ( ( type->in_species( MAMMAL ) && u.pheromone_mammal ) ||
+          ( type->in_species( INSECT ) && u.pheromone_insect ) ) ) {
+        effective_anger -= 20;
+    }
 
-        if( u->has_trait( terrifying ) ) {
-            effective_morale -= 10;
-        }
+    if( u.terrifying ) {
+        effective_morale -= 10;
+    }
 
-        if( has_flag( MF_ANIMAL ) ) {
-            if( u->has_trait( trait_ANIMALEMPATH ) ) {
-                effective_anger -= 10;
-                if( effective_anger < 10 ) {
-                    effective_morale += 55;
-                }
-            } else if( u->has_trait( trait_ANIMALDISCORD ) ) {
-                if( effective_anger >= 10 ) {
-                    effective_anger += 10;
-                }
-                if( effective_anger < 10 ) {
-                    effective_morale -= 5;
-                }
+    if( has_flag( MF_ANIMAL ) ) {
+        if( u.animal_empath ) {
+            effective_anger -= 10;
+            if( effective_anger < 10 ) {
+                effective_morale += 55;
+            }
+        } else if( u.animal_discord ) {
+            if( effective_anger >= 10 ) {
+                effective_anger += 10;
+            }
+            if( effective_anger < 10 ) {
+                effective_morale -= 5;
             }
         }
     }
@@ -951,14 +995,14 @@ bool monster::is_immune_effect( const efftype_id &effect ) const
 
     if( effect == effect_bleed ) {
         return !has_flag(MF_WARM) ||
-            !made_of( material_id( "flesh" ) );
+            !made_of( mat_flesh );
     }
 
     if( effect == effect_paralyzepoison ||
         effect == effect_badpoison ||
         effect == effect_poison ) {
         return !has_flag(MF_WARM) ||
-            (!made_of( material_id( "flesh" ) ) && !made_of( material_id( "iflesh" ) ));
+            (!made_of( mat_flesh ) && !made_of( mat_iflesh ));
     }
 
     return false;
@@ -982,7 +1026,7 @@ bool monster::is_immune_damage( const damage_type dt ) const
     case DT_STAB:
         return false;
     case DT_HEAT:
-        return made_of( material_id( "steel" ) ) || made_of( material_id( "stone" ) ); // Ugly hardcode - remove later
+        return made_of( mat_steel ) || made_of( mat_stone ); // Ugly hardcode - remove later
     case DT_COLD:
         return false;
     case DT_ELECTRIC:
@@ -1395,11 +1439,9 @@ void monster::add_effect( const efftype_id &eff_id, const time_duration dur, bod
 std::string monster::get_effect_status() const
 {
     std::vector<std::string> effect_status;
-    for( auto &elem : *effects ) {
-        for( auto &_it : elem.second ) {
-            if( elem.first->is_show_in_info() ) {
-                effect_status.push_back( _it.second.disp_name() );
-            }
+    for( const effect &elem : *effects ) {
+        if( elem.get_effect_type()->is_show_in_info() ) {
+            effect_status.push_back( elem.disp_name() );
         }
     }
 
@@ -1818,9 +1860,9 @@ void monster::process_one_effect( effect &it, bool is_new )
         effect_cache[MOVEMENT_IMPAIRED] = true;
     } else if( id == effect_onfire ) {
         int dam = 0;
-        if( made_of( material_id( "veggy" ) ) ) {
+        if( made_of( mat_veggy ) ) {
             dam = rng( 10, 20 );
-        } else if( made_of( material_id( "flesh" ) ) || made_of( material_id( "iflesh" ) ) ) {
+        } else if( made_of( mat_flesh ) || made_of( mat_iflesh ) ) {
             dam = rng( 5, 10 );
         }
 
@@ -1838,9 +1880,11 @@ void monster::process_one_effect( effect &it, bool is_new )
 void monster::process_effects()
 {
     // Monster only effects
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            process_one_effect( _effect_it.second, false );
+    // Processing an effect may add or remove others, so look each one up again.
+    for( const auto &key : effects->keys() ) {
+        effect *e = effects->find( key.first, key.second );
+        if( e != nullptr ) {
+            process_one_effect( *e, false );
         }
     }
 
@@ -1912,9 +1956,9 @@ bool monster::make_fungus()
     if( type->in_species( FUNGUS ) ) { // No friendly-fungalizing ;-)
         return true;
     }
-    if( !made_of( material_id( "flesh" ) ) && !made_of( material_id( "hflesh" ) ) &&
-        !made_of( material_id( "veggy" ) ) && !made_of( material_id( "iflesh" ) ) &&
-        !made_of( material_id( "bone" ) ) ) {
+    if( !made_of( mat_flesh ) && !made_of( mat_hflesh ) &&
+        !made_of( mat_veggy ) && !made_of( mat_iflesh ) &&
+        !made_of( mat_bone ) ) {
         // No fungalizing robots or weird stuff (mi-gos are technically fungi, blobs are goo)
         return true;
     }
@@ -2244,7 +2288,7 @@ void monster::on_load()
         regen = 10.0f;
     } else if( has_flag( MF_REVIVES ) ) {
         regen = 1.0f / HOURS(1);
-    } else if( made_of( material_id( "flesh" ) ) || made_of( material_id( "veggy" ) ) ) {
+    } else if( made_of( mat_flesh ) || made_of( mat_veggy ) ) {
         // Most living stuff here
         regen = 0.25f / HOURS(1);
     }
@@ -6,6 +6,7 @@
 #include "enums.h"
 #include "int_id.h"
 #include "calendar.h"
+#include "optional.h"
 
 #include <vector>
 #include <map>
@@ -23,6 +24,8 @@ class item;
 class monfaction;
 class player;
 class Character;
+class world_snapshot;
+struct creature_state;
 struct mtype;
 enum monster_trigger : int;
 enum field_id : int;
@@ -43,6 +46,28 @@ class mon_special_attack
         // deserialize inline in monster::load due to backwards/forwards compatibility concerns
 };
 
+/**
+ * What a monster decided in @ref monster::plan_intent, it is carried out by
+ * @ref monster::apply_intent.
+ */
+struct monster_intent {
+    /** Where to go, see @ref monster::set_dest. */
+    cata::optional<tripoint> dest;
+    /** Give up on the current destination, if there is no new one. */
+    bool unset_dest = false;
+    /** Changes to anger, morale and friendliness. */
+    int anger = 0;
+    int morale = 0;
+    int friendly = 0;
+    /** New wander destination (x and y only), for swarms that got too crowded. */
+    cata::optional<point> wander;
+
+    bool operator==( const monster_intent &rhs ) const {
+        return dest == rhs.dest && unset_dest == rhs.unset_dest && anger == rhs.anger &&
+               morale == rhs.morale && friendly == rhs.friendly && wander == rhs.wander;
+    }
+};
+
 enum monster_attitude {
     MATT_NULL = 0,
     MATT_FRIEND,
@@ -55,6 +80,30 @@ enum monster_attitude {
     NUM_MONSTER_ATTITUDES
 };
 
+/**
+ * The things about a character that change how monsters feel about them, see
+ * @ref monster::attitude. Kept apart from the character, so monster planning can look
+ * at a copy of them.
+ */
+struct attitude_traits {
+    /** The character is the player, see game::u. */
+    bool is_player = false;
+    /** An npc that isn't out to kill, friendly dogs and bots won't attack them. */
+    bool peaceful_npc = false;
+    bool bee = false;
+    bool flowers = false;
+    bool mycus_thresh = false;
+    bool pheromone_mammal = false;
+    bool pheromone_insect = false;
+    bool terrifying = false;
+    bool animal_empath = false;
+    bool animal_discord = false;
+
+    /** Traits of nobody in particular, all false. */
+    attitude_traits() = default;
+    explicit attitude_traits( const Character &u );
+};
+
 enum monster_effect_cache_fields {
     MOVEMENT_IMPAIRED = 0,
     FLEEING,
@@ -170,6 +219,19 @@ class monster : public Creature
         // Pass all factions to mon, so that hordes of same-faction mons
         // do not iterate over each other
         void plan( const mfactions &factions );
+
+        // How good of a target is given creature from the snapshot (checks for visibility)
+        float rate_target( const world_snapshot &world, const creature_state &c, float best,
+                           bool smart = false ) const;
+        /**
+         * Decides where to go next, from the monsters, npcs and factions in the snapshot, like
+         * @ref plan does from the live creatures. This only reads from the world, so it may
+         * run on several monsters at once, see the "PARALLEL_MONSTER_PLANNING" option. The
+         * changes to anger and morale only happen in @ref apply_intent, so unlike in @ref plan
+         * they don't change the rest of the plan.
+         */
+        monster_intent plan_intent( const world_snapshot &world ) const;
+        void apply_intent( const monster_intent &intent );
         void move(); // Actual movement
         void footsteps( const tripoint &p ); // noise made by movement
 
@@ -237,8 +299,18 @@ class monster : public Creature
 
         // Combat
         bool is_fleeing( player &u ) const; // True if we're fleeing
+        bool is_fleeing( const creature_state &u ) const; // Same, for a character in a snapshot
         monster_attitude attitude( const Character *u = nullptr ) const; // See the enum above
+        monster_attitude attitude( const attitude_traits &u ) const;
         Attitude attitude_to( const Creature &other ) const override;
+        /**
+         * What @ref attitude_to says about a monster, from the values it looks at: the
+         * factions and friendliness of both monsters, and the morale and anger of the first.
+         */
+        static Attitude attitude_between( const mfaction_id &faction, int friendly, int morale,
+                                          int anger, const mfaction_id &other_faction, int other_friendly );
+        /** What @ref attitude_to says about a character the monster has that attitude to. */
+        static Attitude attitude_for( monster_attitude att );
         void process_triggers(); // Process things that anger/scare us
         void process_trigger( monster_trigger trig, int amount ); // Single trigger
         int trigger_sum( const std::set<monster_trigger> &triggers ) const;
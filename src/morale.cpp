@@ -22,6 +22,14 @@ static const efftype_id effect_hot( "hot" );
 static const efftype_id effect_took_prozac( "took_prozac" );
 static const efftype_id effect_took_prozac_bad( "took_prozac_bad" );
 
+static const trait_id trait_CENOBITE( "CENOBITE" );
+static const trait_id trait_FLOWERS( "FLOWERS" );
+static const trait_id trait_MASOCHIST( "MASOCHIST" );
+static const trait_id trait_MASOCHIST_MED( "MASOCHIST_MED" );
+static const trait_id trait_ROOTS1( "ROOTS1" );
+static const trait_id trait_ROOTS2( "ROOTS2" );
+static const trait_id trait_ROOTS3( "ROOTS3" );
+
 namespace
 {
 static const std::string item_name_placeholder = "%s"; // Used to address an item name
@@ -682,9 +690,9 @@ void player_morale::update_stylish_bonus()
 
 void player_morale::update_masochist_bonus()
 {
-    const bool amateur_masochist = has_mutation( trait_id( "MASOCHIST" ) );
-    const bool advanced_masochist = has_mutation( trait_id( "MASOCHIST_MED" ) ) ||
-                                    has_mutation( trait_id( "CENOBITE" ) );
+    const bool amateur_masochist = has_mutation( trait_MASOCHIST );
+    const bool advanced_masochist = has_mutation( trait_MASOCHIST_MED ) ||
+                                    has_mutation( trait_CENOBITE );
     const bool any_masochist = amateur_masochist || advanced_masochist;
 
     int bonus = 0;
@@ -739,11 +747,11 @@ void player_morale::update_constrained_penalty()
     };
     int pen = 0;
 
-    if( has_mutation( trait_id( "FLOWERS" ) ) ) {
+    if( has_mutation( trait_FLOWERS ) ) {
         pen += bp_pen( bp_head, 10 );
     }
-    if( has_mutation( trait_id( "ROOTS1" ) ) || has_mutation( trait_id( "ROOTS2" ) ) ||
-        has_mutation( trait_id( "ROOTS3" ) ) ) {
+    if( has_mutation( trait_ROOTS1 ) || has_mutation( trait_ROOTS2 ) ||
+        has_mutation( trait_ROOTS3 ) ) {
         pen += bp_pen( bp_foot_l, 5 );
         pen += bp_pen( bp_foot_r, 5 );
     }
@@ -9,6 +9,12 @@
 
 const species_id MOLLUSK( "MOLLUSK" );
 
+static const material_id mat_bone( "bone" );
+static const material_id mat_flesh( "flesh" );
+static const material_id mat_hflesh( "hflesh" );
+static const material_id mat_iflesh( "iflesh" );
+static const material_id mat_veggy( "veggy" );
+
 mtype::mtype()
 {
     id = mtype_id::NULL_ID();
@@ -122,13 +128,13 @@ field_id mtype::bloodType() const
     if( has_flag( MF_LARVA ) || has_flag( MF_ARTHROPOD_BLOOD ) ) {
         return fd_blood_invertebrate;
     }
-    if( made_of( material_id( "veggy" ) ) ) {
+    if( made_of( mat_veggy ) ) {
         return fd_blood_veggy;
     }
-    if( made_of( material_id( "iflesh" ) ) ) {
+    if( made_of( mat_iflesh ) ) {
         return fd_blood_insect;
     }
-    if( has_flag( MF_WARM ) && made_of( material_id( "flesh" ) ) ) {
+    if( has_flag( MF_WARM ) && made_of( mat_flesh ) ) {
         return fd_blood;
     }
     return fd_null;
@@ -139,13 +145,13 @@ field_id mtype::gibType() const
     if( has_flag( MF_LARVA ) || in_species( MOLLUSK ) ) {
         return fd_gibs_invertebrate;
     }
-    if( made_of( material_id( "veggy" ) ) ) {
+    if( made_of( mat_veggy ) ) {
         return fd_gibs_veggy;
     }
-    if( made_of( material_id( "iflesh" ) ) ) {
+    if( made_of( mat_iflesh ) ) {
         return fd_gibs_insect;
     }
-    if( made_of( material_id( "flesh" ) ) ) {
+    if( made_of( mat_flesh ) ) {
         return fd_gibs_flesh;
     }
     // There are other materials not listed here like steel, protoplasmic, powder, null, stone, bone
@@ -155,18 +161,18 @@ field_id mtype::gibType() const
 itype_id mtype::get_meat_itype() const
 {
     if( has_flag( MF_POISON ) ) {
-        if( made_of( material_id( "flesh" ) ) || made_of( material_id( "hflesh" ) ) ) {
+        if( made_of( mat_flesh ) || made_of( mat_hflesh ) ) {
             return "meat_tainted";
-        } else if( made_of( material_id( "iflesh" ) ) ) {
+        } else if( made_of( mat_iflesh ) ) {
             //In the future, insects could drop insect flesh rather than plain ol' meat.
             return "meat_tainted";
-        } else if( made_of( material_id( "veggy" ) ) ) {
+        } else if( made_of( mat_veggy ) ) {
             return "veggy_tainted";
-        } else if( made_of( material_id( "bone" ) ) ) {
+        } else if( made_of( mat_bone ) ) {
             return "bone_tainted";
         }
     } else {
-        if( made_of( material_id( "flesh" ) ) || made_of( material_id( "hflesh" ) ) ) {
+        if( made_of( mat_flesh ) || made_of( mat_hflesh ) ) {
             if( has_flag( MF_HUMAN ) ) {
                 return "human_flesh";
             } else if( has_flag( MF_AQUATIC ) ) {
@@ -174,12 +180,12 @@ itype_id mtype::get_meat_itype() const
             } else {
                 return "meat";
             }
-        } else if( made_of( material_id( "iflesh" ) ) ) {
+        } else if( made_of( mat_iflesh ) ) {
             //In the future, insects could drop insect flesh rather than plain ol' meat.
             return "meat";
-        } else if( made_of( material_id( "veggy" ) ) ) {
+        } else if( made_of( mat_veggy ) ) {
             return "veggy";
-        } else if( made_of( material_id( "bone" ) ) ) {
+        } else if( made_of( mat_bone ) ) {
             return "bone";
         }
     }
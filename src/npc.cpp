@@ -1466,6 +1466,11 @@ int npc::value( const item &it ) const
 }
 
 int npc::value( const item &it, int market_price ) const
+{
+    return value( it, market_price, weapon_value( weapon ) );
+}
+
+int npc::value( const item &it, int market_price, double own_weapon_value ) const
 {
     if( it.is_dangerous() || ( it.has_flag( "BOMB" ) && it.active ) || it.made_of( LIQUID ) ) {
         // NPCs won't be interested in buying active explosives or spilled liquids
@@ -1473,8 +1478,7 @@ int npc::value( const item &it, int market_price ) const
     }
 
     int ret = 0;
-    // TODO: Cache own weapon value (it can be a bit expensive to compute 50 times/turn)
-    double weapon_val = weapon_value( it ) - weapon_value( weapon );
+    double weapon_val = weapon_value( it ) - own_weapon_value;
     if( weapon_val > 0 ) {
         ret += weapon_val;
     }
@@ -551,6 +551,8 @@ class npc : public player
         void update_worst_item_value(); // Find the worst value in our inventory
         int value( const item &it ) const;
         int value( const item &it, int market_price ) const;
+        // Same, with weapon_value( weapon ) worked out by the caller
+        int value( const item &it, int market_price, double own_weapon_value ) const;
         bool wear_if_wanted( const item &it );
         bool wield( item &it ) override;
         bool adjust_worn();
@@ -570,7 +572,16 @@ class npc : public player
         bool wants_to_buy( const item &it, int at_price, int market_price ) const;
 
         // AI helpers
+        /**
+         * Works out the danger around us and picks a target. This only reads the world and
+         * writes to ai_cache, so several npcs can do it at once.
+         */
         void regen_ai_cache();
+        /**
+         * Whether the target and friends in ai_cache are still alive, and the target is still
+         * seen and hostile. @ref move_with_ai_cache makes a new cache if not.
+         */
+        bool ai_cache_valid() const;
         const Creature *current_target() const;
         Creature *current_target();
 
@@ -600,6 +611,8 @@ class npc : public player
 
         // Movement; the following are defined in npcmove.cpp
         void move(); // Picks an action & a target and calls execute_action
+        // Same as move, but with the target from an earlier call to regen_ai_cache
+        void move_with_ai_cache();
         void execute_action( npc_action action ); // Performs action
         void process_turn() override;
 
@@ -300,7 +300,10 @@ float npc::character_danger( const Character &uc ) const
 
     ret *= std::max( 0.5, u.get_speed() / 100.0 );
 
-    add_msg( m_debug, "%s danger: %1f", u.disp_name().c_str(), ret );
+    // Debug messages only show in debug mode, where the ai cache isn't refreshed in parallel
+    if( debug_mode ) {
+        add_msg( m_debug, "%s danger: %1f", u.disp_name().c_str(), ret );
+    }
     return ret;
 }
 
@@ -317,9 +320,52 @@ void npc::regen_ai_cache()
     choose_target();
 }
 
+// Monsters killed by die() are only flagged dead, their hp may still be above 0
+static bool is_killed( const Creature &critter )
+{
+    const monster *const mon = dynamic_cast<const monster *>( &critter );
+    return mon != nullptr ? mon->is_dead() : critter.is_dead_state();
+}
+
+bool npc::ai_cache_valid() const
+{
+    for( const std::shared_ptr<Creature> &ally : ai_cache.friends ) {
+        if( is_killed( *ally ) ) {
+            return false;
+        }
+    }
+    const Creature *target = current_target();
+    if( target == nullptr ) {
+        return true;
+    }
+    if( is_killed( *target ) || !sees( *target ) ) {
+        return false;
+    }
+    // Still hostile in the way choose_target picked it
+    if( const monster *const mon = dynamic_cast<const monster *>( target ) ) {
+        const monster_attitude att = mon->attitude( this );
+        return att != MATT_FRIEND && att != MATT_FPASSIVE;
+    } else if( target == &g->u ) {
+        return is_enemy();
+    }
+    const Creature::Attitude att = attitude_to( *target );
+    return att != Creature::A_FRIENDLY && att != Creature::A_NEUTRAL;
+}
+
 void npc::move()
 {
     regen_ai_cache();
+    move_with_ai_cache();
+}
+
+void npc::move_with_ai_cache()
+{
+    // The caches of all npcs are made before any of them acts, the npcs that acted since
+    // may have killed, scared or hidden what this one saw.
+    if( !ai_cache_valid() ) {
+        regen_ai_cache();
+    }
+
     npc_action action = npc_undecided;
 
     static const std::string no_target_str = "none";
@@ -1865,24 +1911,30 @@ void npc::find_item()
         return;
     }
 
+    const double own_weapon_value = weapon_value( weapon );
     const auto consider_item =
-        [&wanted, &best_value, whitelisting, volume_allowed, weight_allowed, this]
+        [&wanted, &best_value, whitelisting, volume_allowed, weight_allowed, own_weapon_value,
+                 this]
     ( const item & it, const tripoint & p ) {
         if( it.made_of( LIQUID ) ) {
             // Don't even consider liquids.
             return;
         }
 
+        // The value takes much longer to work out, so check whether we can carry it first
+        if( it.volume() > volume_allowed || it.weight() > weight_allowed ) {
+            return;
+        }
+
         if( whitelisting && !item_whitelisted( it ) ) {
             return;
         }
 
         // When using a whitelist, skip the value check
         // @todo: Whitelist hierarchy?
-        int itval = whitelisting ? 1000 : value( it );
+        int itval = whitelisting ? 1000 : value( it, it.price( true ), own_weapon_value );
 
-        if( itval > best_value &&
-            ( it.volume() <= volume_allowed && it.weight() <= weight_allowed ) ) {
+        if( itval > best_value ) {
             wanted_item_pos = p;
             wanted = &( it );
             best_value = itval;
@@ -1909,6 +1961,8 @@ void npc::find_item()
         }
     };
 
+    // Skip looking at the items on each tile if there are none around us
+    const bool items_in_range = g->m.has_items_in_radius( pos(), range );
     for( const tripoint &p : closest_tripoints_first( range, pos() ) ) {
         // TODO: Make this sight check not overdraw nearby tiles
         // TODO: Optimize that zone check
@@ -1916,7 +1970,7 @@ void npc::find_item()
             continue;
         }
 
-        if( g->m.sees_some_items( p, *this ) && sees( p ) ) {
+        if( items_in_range && g->m.sees_some_items( p, *this ) && sees( p ) ) {
             for( const item &it : g->m.i_at( p ) ) {
                 consider_item( it, p );
             }
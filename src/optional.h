@@ -229,6 +229,18 @@ class optional
         }
 };
 
+template<typename T, typename U>
+constexpr bool operator==( const optional<T> &lhs, const optional<U> &rhs )
+{
+    return lhs.has_value() == rhs.has_value() && ( !lhs.has_value() || *lhs == *rhs );
+}
+
+template<typename T, typename U>
+constexpr bool operator!=( const optional<T> &lhs, const optional<U> &rhs )
+{
+    return !( lhs == rhs );
+}
+
 } // namespace cata
 
 #endif
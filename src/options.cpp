@@ -825,6 +825,7 @@ std::vector<std::pair<std::string, std::string>> options_manager::build_soundpac
 void options_manager::init()
 {
     options.clear();
+    invalidate_handles();
     vPages.clear();
     mPageItems.clear();
     mOptionsSort.clear();
@@ -983,6 +984,31 @@ void options_manager::init()
         true
         );
 
+    add( "PREGENERATE_OVERMAPS", "general", translate_marker( "Generate overmaps in background" ),
+        translate_marker( "If true, the overmap next to the one you are in is generated in the background when you get close to its border, instead of when you first need it.  Reduces stuttering when traveling." ),
+        true
+        );
+
+    add( "LOAD_MAP_AHEAD", "general", translate_marker( "Load map ahead" ),
+        translate_marker( "If true, the part of the map you are heading to is loaded or generated a few turns before you get there, instead of all at once when you arrive.  Reduces stuttering when driving." ),
+        true
+        );
+
+    add( "WORKER_THREADS", "general", translate_marker( "Worker threads" ),
+        translate_marker( "Number of threads used for work that can be done in parallel, including the main one.  1 does all work on the main thread, 0 uses one per processor core." ),
+        0, 64, 0
+        );
+
+    add( "PARALLEL_MONSTER_PLANNING", "general", translate_marker( "Plan monster moves in parallel" ),
+        translate_marker( "If true, monsters make their first plan of the turn at the same time on the worker threads, from how the world was at the start of the turn." ),
+        false
+        );
+
+    add( "PARALLEL_NPC_PLANNING", "general", translate_marker( "Plan NPC moves in parallel" ),
+        translate_marker( "If true, NPCs assess the danger around them and pick their targets at the same time on the worker threads, before any of them acts." ),
+        false
+        );
+
     add( "DEATHCAM", "general", translate_marker( "DeathCam" ),
         translate_marker( "Always: Always start deathcam.  Ask: Query upon death.  Never: Never show deathcam." ),
         { { "always", translate_marker( "Always" ) }, { "ask", translate_marker( "Ask" ) }, { "never", translate_marker( "Never" ) } }, "ask"
@@ -2023,6 +2049,7 @@ std::string options_manager::show(bool ingame, const bool world_options_only)
             save();
             if( ingame && world_options_changed ) {
                 world_generator->active_world->WORLD_OPTIONS = ACTIVE_WORLD_OPTIONS;
+                invalidate_handles();
                 world_generator->save_world( world_generator->active_world, false );
             }
         } else {
@@ -2031,6 +2058,7 @@ std::string options_manager::show(bool ingame, const bool world_options_only)
             if (ingame && world_options_changed) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            invalidate_handles();
         }
     }
     if( lang_changed ) {
@@ -91,6 +91,9 @@ class options_manager
 
                 template<typename T>
                 T value_as() const;
+                /** Like @ref value_as, but without checking the type of the option. */
+                template<typename T>
+                T value_as_unchecked() const;
 
                 bool operator==( const cOpt &rhs ) const;
                 bool operator!=( const cOpt &rhs ) const {
@@ -174,6 +177,22 @@ class options_manager
 
         cOpt &get_option( const std::string &name );
 
+        /**
+         * Counter that changes whenever references returned by @ref get_option may
+         * have become invalid. Used by @ref option_handle to know when to look up
+         * the option again.
+         */
+        int get_generation() const {
+            return generation;
+        }
+        /**
+         * Must be called when an options container is replaced or cleared, e.g. when
+         * the active world or its options change.
+         */
+        void invalidate_handles() {
+            generation++;
+        }
+
         //add hidden external option with value
         void add_external( const std::string sNameIn, const std::string sPageIn, const std::string sType,
                            const std::string sMenuTextIn, const std::string sTooltipIn );
@@ -223,8 +242,33 @@ class options_manager
         std::vector<std::pair<std::string, std::string>> vPages;
         std::map<int, std::vector<std::string>> mPageItems;
         int iWorldOptPage;
+        int generation = 0;
 };
 
+template<>
+inline std::string options_manager::cOpt::value_as_unchecked<std::string>() const
+{
+    return sSet;
+}
+
+template<>
+inline bool options_manager::cOpt::value_as_unchecked<bool>() const
+{
+    return bSet;
+}
+
+template<>
+inline float options_manager::cOpt::value_as_unchecked<float>() const
+{
+    return fSet;
+}
+
+template<>
+inline int options_manager::cOpt::value_as_unchecked<int>() const
+{
+    return iSet;
+}
+
 bool use_narrow_sidebar(); // short-circuits to on if terminal is too small
 
 /** A mapping(string:string) that stores all tileset values.
@@ -246,4 +290,33 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+/**
+ * Pre-resolved, typed reference to an option, for code that reads an option very often.
+ * The option is looked up (and its type checked) on first use, and again only after
+ * @ref options_manager::invalidate_handles has been called.
+ * Usage: `static const option_handle<bool> opt_autosave( "AUTOSAVE" );`
+ * and later `if( opt_autosave.value() ) ...`.
+ */
+template<typename T>
+class option_handle
+{
+    public:
+        explicit option_handle( const std::string &name ) : name( name ) {}
+
+        T value() const {
+            const options_manager &opts = get_options();
+            if( opt == nullptr || generation != opts.get_generation() ) {
+                opt = &get_options().get_option( name );
+                generation = opts.get_generation();
+                return opt->value_as<T>();
+            }
+            return opt->value_as_unchecked<T>();
+        }
+
+    private:
+        std::string name;
+        mutable const options_manager::cOpt *opt = nullptr;
+        mutable int generation = 0;
+};
+
 #endif
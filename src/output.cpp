@@ -9,6 +9,9 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <errno.h>
 
 #include "color.h"
@@ -58,7 +61,7 @@ extern bool use_tiles;
 extern bool test_mode;
 
 // utf8 version
-std::vector<std::string> foldstring( std::string str, int width )
+static std::vector<std::string> fold_lines( const std::string &str, const int width )
 {
     std::vector<std::string> lines;
     if( width < 1 ) {
@@ -78,6 +81,123 @@ std::vector<std::string> foldstring( std::string str, int width )
     return lines;
 }
 
+static std::vector<color_run> split_into_runs( const std::string &line )
+{
+    std::vector<color_run> runs;
+    for( const std::string &seg : split_by_color( line ) ) {
+        if( seg.empty() ) {
+            continue;
+        }
+        color_run run;
+        if( seg[0] == '<' ) {
+            // Same as get_color_from_tag, but keeps the base color open
+            const size_t tag_close = seg.find( '>' );
+            if( seg.compare( 0, 7, "<color_" ) == 0 && tag_close != std::string::npos ) {
+                run.tag = color_run::tag_type::color;
+                run.color = color_from_string( seg.substr( 7, tag_close - 7 ) );
+            } else {
+                run.tag = color_run::tag_type::base;
+            }
+            run.text = rm_prefix( seg );
+        } else {
+            run.text = seg;
+        }
+        runs.push_back( std::move( run ) );
+    }
+    return runs;
+}
+
+namespace
+{
+
+/** The least recently used results of fold_colored_text are dropped first. */
+class colored_text_cache
+{
+    public:
+        std::shared_ptr<const folded_colored_text> get( const std::string &text, const int width ) {
+            const key_type key( text, std::max( width, 0 ) );
+            std::lock_guard<std::mutex> lock( mutex );
+            const auto found = index.find( key );
+            if( found != index.end() ) {
+                entries.splice( entries.begin(), entries, found->second );
+                return found->second->second;
+            }
+
+            auto folded = std::make_shared<folded_colored_text>();
+            folded->lines = fold_lines( text, key.second );
+            for( const std::string &line : folded->lines ) {
+                folded->runs.push_back( split_into_runs( line ) );
+            }
+            entries.emplace_front( key, folded );
+            index.emplace( key, entries.begin() );
+            if( entries.size() > capacity ) {
+                index.erase( entries.back().first );
+                entries.pop_back();
+            }
+            return folded;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock( mutex );
+            index.clear();
+            entries.clear();
+        }
+
+    private:
+        using key_type = std::pair<std::string, int>;
+        struct key_hash {
+            size_t operator()( const key_type &k ) const {
+                return std::hash<std::string>()( k.first ) ^ ( static_cast<size_t>( k.second ) * 31 );
+            }
+        };
+        using entry_list = std::list<std::pair<key_type, std::shared_ptr<const folded_colored_text>>>;
+
+        /** Enough for the texts of a few screens, the sidebar and the message log. */
+        static constexpr size_t capacity = 1024;
+        entry_list entries;
+        std::unordered_map<key_type, entry_list::iterator, key_hash> index;
+        std::mutex mutex;
+};
+
+colored_text_cache &get_colored_text_cache()
+{
+    static colored_text_cache cache;
+    return cache;
+}
+
+} // namespace
+
+std::shared_ptr<const folded_colored_text> fold_colored_text( const std::string &text,
+        const int width )
+{
+    return get_colored_text_cache().get( text, width );
+}
+
+void clear_colored_text_cache()
+{
+    get_colored_text_cache().clear();
+}
+
+std::vector<std::string> foldstring( std::string str, int width )
+{
+    return fold_colored_text( str, width )->lines;
+}
+
+static void print_color_runs( const catacurses::window &w, const int y, const int x,
+                              nc_color &color, const nc_color base_color,
+                              const std::vector<color_run> &runs )
+{
+    wmove( w, y, x );
+    for( const color_run &run : runs ) {
+        if( run.tag == color_run::tag_type::color ) {
+            color = run.color;
+        } else if( run.tag == color_run::tag_type::base ) {
+            color = base_color;
+        }
+        wprintz( w, color, run.text );
+    }
+}
+
 std::vector<std::string> split_by_color( const std::string &s )
 {
     std::vector<std::string> ret;
@@ -115,20 +235,7 @@ std::string remove_color_tags( const std::string &s )
 void print_colored_text( const catacurses::window &w, int y, int x, nc_color &color,
                          nc_color base_color, const std::string &text )
 {
-    wmove( w, y, x );
-    const auto color_segments = split_by_color( text );
-    for( auto seg : color_segments ) {
-        if( seg.empty() ) {
-            continue;
-        }
-
-        if( seg[0] == '<' ) {
-            color = get_color_from_tag( seg, base_color );
-            seg = rm_prefix( seg );
-        }
-
-        wprintz( w, color, seg );
-    }
+    print_color_runs( w, y, x, color, base_color, fold_colored_text( text, 0 )->runs.front() );
 }
 
 void trim_and_print( const catacurses::window &w, int begin_y, int begin_x, int width,
@@ -183,7 +290,8 @@ int print_scrollable( const catacurses::window &w, int begin_line, const std::st
                       nc_color base_color, const std::string &scroll_msg )
 {
     const size_t wwidth = getmaxx( w );
-    const auto text_lines = foldstring( text, wwidth );
+    const auto folded = fold_colored_text( text, wwidth );
+    const auto &text_lines = folded->lines;
     size_t wheight = getmaxy( w );
     const auto print_scroll_msg = text_lines.size() > wheight;
     if( print_scroll_msg && !scroll_msg.empty() ) {
@@ -197,7 +305,7 @@ int print_scrollable( const catacurses::window &w, int begin_line, const std::st
     }
     nc_color color = base_color;
     for( size_t i = 0; i + begin_line < text_lines.size() && i < wheight; ++i ) {
-        print_colored_text( w, i, 0, color, base_color, text_lines[i + begin_line] );
+        print_color_runs( w, i, 0, color, base_color, folded->runs[i + begin_line] );
     }
     if( print_scroll_msg && !scroll_msg.empty() ) {
         color = c_white;
@@ -211,12 +319,11 @@ int fold_and_print( const catacurses::window &w, int begin_y, int begin_x, int w
                     nc_color base_color, const std::string &text )
 {
     nc_color color = base_color;
-    std::vector<std::string> textformatted;
-    textformatted = foldstring( text, width );
-    for( int line_num = 0; ( size_t )line_num < textformatted.size(); line_num++ ) {
-        print_colored_text( w, line_num + begin_y, begin_x, color, base_color, textformatted[line_num] );
+    const auto folded = fold_colored_text( text, width );
+    for( int line_num = 0; ( size_t )line_num < folded->runs.size(); line_num++ ) {
+        print_color_runs( w, line_num + begin_y, begin_x, color, base_color, folded->runs[line_num] );
     }
-    return textformatted.size();
+    return folded->runs.size();
 }
 
 int fold_and_print_from( const catacurses::window &w, int begin_y, int begin_x, int width,
@@ -224,27 +331,24 @@ int fold_and_print_from( const catacurses::window &w, int begin_y, int begin_x,
 {
     const int iWinHeight = getmaxy( w );
     nc_color color = base_color;
-    std::vector<std::string> textformatted;
-    textformatted = foldstring( text, width );
-    for( int line_num = 0; ( size_t )line_num < textformatted.size(); line_num++ ) {
+    const auto folded = fold_colored_text( text, width );
+    for( int line_num = 0; ( size_t )line_num < folded->runs.size(); line_num++ ) {
         if( line_num + begin_y - begin_line == iWinHeight ) {
             break;
         }
         if( line_num >= begin_line ) {
             wmove( w, line_num + begin_y - begin_line, begin_x );
         }
-        // split into colorable sections
-        std::vector<std::string> color_segments = split_by_color( textformatted[line_num] );
-        // for each section, get the color, and print it
-        std::vector<std::string>::iterator it;
-        for( it = color_segments.begin(); it != color_segments.end(); ++it ) {
-            if( !it->empty() && it->at( 0 ) == '<' ) {
-                color = get_color_from_tag( *it, base_color );
+        // for each colored section, get the color, and print it
+        for( const color_run &run : folded->runs[line_num] ) {
+            if( run.tag == color_run::tag_type::color ) {
+                color = run.color;
+            } else if( run.tag == color_run::tag_type::base ) {
+                color = base_color;
             }
             if( line_num >= begin_line ) {
-                std::string l = rm_prefix( *it );
-                if( l != "--" ) { // -- is a separation line!
-                    wprintz( w, color, rm_prefix( *it ) );
+                if( run.text != "--" ) { // -- is a separation line!
+                    wprintz( w, color, run.text );
                 } else {
                     for( int i = 0; i < width; i++ ) {
                         wputch( w, c_dark_gray, LINE_OXOX );
@@ -253,7 +357,7 @@ int fold_and_print_from( const catacurses::window &w, int begin_y, int begin_x,
             }
         }
     }
-    return textformatted.size();
+    return folded->runs.size();
 }
 
 void multipage( const catacurses::window &w, std::vector<std::string> text, std::string caption,
@@ -317,6 +317,37 @@ std::string word_rewrap( const std::string &ins, int width );
 std::vector<size_t> get_tag_positions( const std::string &s );
 std::vector<std::string> split_by_color( const std::string &s );
 
+/** A piece of text without its @ref color_tags, which is printed in one color. */
+struct color_run {
+    enum class tag_type {
+        /** No tag in front of the text, it keeps the color of the text before it. */
+        none,
+        /** A closing (or unknown) tag, the text goes back to the base color. */
+        base,
+        /** A color tag, the text is printed in @ref color. */
+        color,
+    };
+    tag_type tag = tag_type::none;
+    nc_color color;
+    std::string text;
+};
+
+/** Text folded like @ref foldstring does, with each line also split into @ref color_run. */
+struct folded_colored_text {
+    std::vector<std::string> lines;
+    std::vector<std::vector<color_run>> runs;
+};
+
+/**
+ * Folds the text to the width and splits it at its @ref color_tags. A width below 1 leaves
+ * the text in one line. The most recently used results are kept, so redrawing the same
+ * text each frame doesn't parse it again.
+ */
+std::shared_ptr<const folded_colored_text> fold_colored_text( const std::string &text,
+        int width );
+/** Forgets the results of @ref fold_colored_text, needed when the colors are changed. */
+void clear_colored_text_cache();
+
 bool query_yn( const std::string &msg );
 template<typename ...Args>
 inline bool query_yn( const char *const msg, Args &&... args )
@@ -51,6 +51,7 @@
 #include <cstring>
 #include <ostream>
 #include <algorithm>
+#include <mutex>
 #include <numeric>
 
 #define dbg(x) DebugLog((DebugLevel)(x),D_MAP_GEN) << __FILE__ << ":" << __LINE__ << ": "
@@ -692,10 +693,35 @@ void overmap_terrains::finalize()
     set_oter_ids();
 }
 
+// Terrains that is_ot_type matches with a type, by type. Only filled on demand, and
+// overmaps are also generated in the background, so it's locked. The vectors stay where
+// they are when other types are added.
+static std::unordered_map<std::string, std::vector<oter_id>> matching_terrains_cache;
+static std::mutex matching_terrains_mutex;
+
+static const std::vector<oter_id> &matching_terrains( const std::string &otype )
+{
+    std::lock_guard<std::mutex> lock( matching_terrains_mutex );
+    const auto iter = matching_terrains_cache.find( otype );
+    if( iter != matching_terrains_cache.end() ) {
+        return iter->second;
+    }
+    std::vector<oter_id> &result = matching_terrains_cache[otype];
+    for( const oter_t &elem : terrains.get_all() ) {
+        const oter_id id = elem.id.id();
+        if( is_ot_type( otype, id ) ) {
+            result.push_back( id );
+        }
+    }
+    return result;
+}
+
 void overmap_terrains::reset()
 {
     terrain_types.reset();
     terrains.reset();
+    std::lock_guard<std::mutex> lock( matching_terrains_mutex );
+    matching_terrains_cache.clear();
 }
 
 size_t overmap_terrains::count()
@@ -1174,6 +1200,12 @@ overmap::overmap( int const x, int const y ) : loc( x, y )
     }
     settings = rsit->second;
 
+    gen_options.world_seed = g->get_seed();
+    gen_options.city_size = get_option<int>( "CITY_SIZE" );
+    gen_options.city_spacing = get_option<int>( "CITY_SPACING" );
+    gen_options.wander_spawns = get_option<bool>( "WANDER_SPAWNS" );
+    gen_options.classic_zombies = get_option<bool>( "CLASSIC_ZOMBIES" );
+
     init_layers();
 }
 
@@ -1228,6 +1260,11 @@ oter_id &overmap::ter(const int x, const int y, const int z)
         return ot_null;
     }
 
+    terrain_index &index = terrain_indices[z + OVERMAP_DEPTH];
+    if( index.built && !index.touched_at[x * OMAPY + y] ) {
+        index.touched_at[x * OMAPY + y] = true;
+        index.touched.emplace_back( x, y );
+    }
     return layer[z + OVERMAP_DEPTH].terrain[x][y];
 }
 
@@ -1278,19 +1315,19 @@ bool overmap::is_explored(int const x, int const y, int const z) const
 
 bool overmap::mongroup_check(const mongroup &candidate) const
 {
-    const auto matching_range = zg.equal_range(candidate.pos);
-    return std::find_if( matching_range.first, matching_range.second,
-        [candidate](std::pair<tripoint, mongroup> match) {
+    const std::vector<const mongroup *> matching = zg.groups_at( candidate.pos );
+    return std::any_of( matching.begin(), matching.end(),
+        [&candidate]( const mongroup *match ) {
             // This is extra strict since we're using it to test serialization.
-            return candidate.type == match.second.type && candidate.pos == match.second.pos &&
-                candidate.radius == match.second.radius &&
-                candidate.population == match.second.population &&
-                candidate.target == match.second.target &&
-                candidate.interest == match.second.interest &&
-                candidate.dying == match.second.dying &&
-                candidate.horde == match.second.horde &&
-                candidate.diffuse == match.second.diffuse;
-        } ) != matching_range.second;
+            return candidate.type == match->type && candidate.pos == match->pos &&
+                candidate.radius == match->radius &&
+                candidate.population == match->population &&
+                candidate.target == match->target &&
+                candidate.interest == match->interest &&
+                candidate.dying == match->dying &&
+                candidate.horde == match->horde &&
+                candidate.diffuse == match->diffuse;
+        } );
 }
 
 bool overmap::monster_check(const std::pair<tripoint, monster> &candidate) const
@@ -1501,6 +1538,11 @@ void overmap::generate( const overmap *north, const overmap *east,
                         overmap_special_batch &enabled_specials )
 {
     dbg(D_INFO) << "overmap::generate start...";
+    // Only depend on the world and the position, so the result is the same no matter
+    // when and on which thread the overmap is generated (see overmapbuffer::pregenerate).
+    const unsigned int seed = gen_options.world_seed ^ ( static_cast<unsigned int>( loc.x ) * 73856093u ) ^
+                              ( static_cast<unsigned int>( loc.y ) * 19349663u );
+    const rng_seed_scope seeded_rng( seed );
     std::vector<point> river_start;// West/North endpoints of rivers
     std::vector<point> river_end; // East/South endpoints of rivers
 
@@ -1908,6 +1950,58 @@ std::vector<point> overmap::find_terrain(const std::string &term, int zlevel)
     return found;
 }
 
+void overmap::update_terrain_index( const int z ) const
+{
+    terrain_index &index = terrain_indices[z + OVERMAP_DEPTH];
+    const map_layer &terrain_layer = layer[z + OVERMAP_DEPTH];
+    if( !index.built ) {
+        index.indexed.resize( OMAPX * OMAPY );
+        index.positions.clear();
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const oter_id &t = terrain_layer.terrain[x][y];
+                index.indexed[x * OMAPY + y] = t;
+                index.positions[t.to_i()].emplace_back( x, y );
+            }
+        }
+        index.built = true;
+        index.touched.clear();
+        index.touched_at.assign( OMAPX * OMAPY, false );
+        return;
+    }
+    for( const point &p : index.touched ) {
+        index.touched_at[p.x * OMAPY + p.y] = false;
+        oter_id &old_ter = index.indexed[p.x * OMAPY + p.y];
+        const oter_id &new_ter = terrain_layer.terrain[p.x][p.y];
+        if( old_ter == new_ter ) {
+            continue;
+        }
+        std::vector<point> &old_positions = index.positions[old_ter.to_i()];
+        const auto iter = std::find( old_positions.begin(), old_positions.end(), p );
+        if( iter != old_positions.end() ) {
+            old_positions.erase( iter );
+        }
+        index.positions[new_ter.to_i()].push_back( p );
+        old_ter = new_ter;
+    }
+    index.touched.clear();
+}
+
+void overmap::find_ot_type( const std::string &otype, const int z, std::vector<point> &result ) const
+{
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return;
+    }
+    update_terrain_index( z );
+    const terrain_index &index = terrain_indices[z + OVERMAP_DEPTH];
+    for( const oter_id &id : matching_terrains( otype ) ) {
+        const auto iter = index.positions.find( id.to_i() );
+        if( iter != index.positions.end() ) {
+            result.insert( result.end(), iter->second.begin(), iter->second.end() );
+        }
+    }
+}
+
 const city &overmap::get_nearest_city( const tripoint &p ) const
 {
     int distance = 999;
@@ -2956,13 +3050,13 @@ tripoint overmap::find_random_omt( const std::string &omt_base_type ) const
 void overmap::process_mongroups()
 {
     for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+        mongroup &mg = *it;
         if( mg.dying ) {
             mg.population = (mg.population * 4) / 5;
             mg.radius = (mg.radius * 9) / 10;
         }
         if( mg.empty() ) {
-            zg.erase( it++ );
+            it = zg.erase( it );
         } else {
             ++it;
         }
@@ -3007,13 +3101,11 @@ void mongroup::wander( overmap &om )
 
 void overmap::move_hordes()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype(zg) tmpzg;
+    // Prevent hordes to be moved twice by moving them after the loop.
+    std::vector<std::pair<mongroup *, tripoint>> moved;
     //MOVE ZOMBIE GROUPS
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    for( mongroup &mg : zg ) {
         if( !mg.horde ) {
-            ++it;
             continue;
         }
 
@@ -3042,28 +3134,25 @@ void overmap::move_hordes()
         if( one_in(movement_chance) && rng(0, 100) < mg.interest ) {
             // @todo: Adjust for monster speed.
             // @todo: Handle moving to adjacent overmaps.
-            if( mg.pos.x > mg.target.x) {
-                mg.pos.x--;
+            tripoint pos = mg.pos;
+            if( pos.x > mg.target.x) {
+                pos.x--;
             }
-            if( mg.pos.x < mg.target.x) {
-                mg.pos.x++;
+            if( pos.x < mg.target.x) {
+                pos.x++;
             }
-            if( mg.pos.y > mg.target.y) {
-                mg.pos.y--;
+            if( pos.y > mg.target.y) {
+                pos.y--;
             }
-            if( mg.pos.y < mg.target.y) {
-                mg.pos.y++;
+            if( pos.y < mg.target.y) {
+                pos.y++;
             }
-
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint, mongroup>( mg.pos, mg ) );
-            zg.erase( it++ );
-        } else {
-            ++it;
+            moved.emplace_back( &mg, pos );
         }
     }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    for( const auto &elem : moved ) {
+        zg.move( *elem.first, elem.second );
+    }
 
 
     if(get_option<bool>( "WANDER_SPAWNS" ) ) {
@@ -3097,16 +3186,12 @@ void overmap::move_hordes()
 
             // Scan for compatible hordes in this area.
             mongroup *add_to_group = NULL;
-            auto group_bucket = zg.equal_range(p);
-            std::for_each( group_bucket.first, group_bucket.second,
-                [&](std::pair<const tripoint, mongroup> &horde_entry ) {
-                mongroup &horde = horde_entry.second;
-
+            for( mongroup *horde : zg.groups_at( p ) ) {
                 // We only absorb zombies into GROUP_ZOMBIE hordes
-                if(horde.horde && !horde.monsters.empty() && horde.type == GROUP_ZOMBIE) {
-                    add_to_group = &horde;
+                if(horde->horde && !horde->monsters.empty() && horde->type == GROUP_ZOMBIE) {
+                    add_to_group = horde;
                 }
-            });
+            }
 
             // If there is no horde to add the monster to, create one.
             if(add_to_group == NULL) {
@@ -3131,8 +3216,8 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power)
 {
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
+    for( mongroup *group : zg.groups_near( p, sig_power ) ) {
+        mongroup &mg = *group;
         if( !mg.horde ) {
             continue;
         }
@@ -3350,11 +3435,11 @@ spawns happen at... <cue Clue music>
 20:56 <kevingranade>: game:pawn_mon() in game.cpp:7380*/
 void overmap::place_cities()
 {
-    int op_city_size = get_option<int>( "CITY_SIZE" );
+    int op_city_size = gen_options.city_size;
     if( op_city_size <= 0 ) {
         return;
     }
-    int op_city_spacing = get_option<int>( "CITY_SPACING" );
+    int op_city_spacing = gen_options.city_spacing;
 
     // spacing dictates how much of the map is covered in cities
     //   city  |  cities  |   size N cities per overmap
@@ -4214,7 +4299,7 @@ om_direction::type overmap::random_special_rotation( const overmap_special &spec
         }
     }
     // Pick first valid rotation at random.
-    std::random_shuffle( first, last );
+    rng_shuffle( first, last );
     const auto rotation = std::find_if( first, last, [&]( om_direction::type elem ) {
         return can_place_special( special, p, elem );
     } );
@@ -4303,7 +4388,7 @@ std::vector<point> overmap::get_sectors() const
             res.emplace_back( x, y );
         }
     }
-    std::random_shuffle( res.begin(), res.end() );
+    rng_shuffle( res.begin(), res.end() );
     return res;
 }
 
@@ -4316,7 +4401,7 @@ bool overmap::place_special_attempt( overmap_special_batch &enabled_specials,
     const tripoint p( rng( x, x + OMSPEC_FREQ - 1 ), rng( y, y + OMSPEC_FREQ - 1 ), 0 );
     const city &nearest_city = get_nearest_city( p );
 
-    std::random_shuffle( enabled_specials.begin(), enabled_specials.end() );
+    rng_shuffle( enabled_specials.begin(), enabled_specials.end() );
     for( auto iter = enabled_specials.begin(); iter != enabled_specials.end(); ++iter ) {
         const auto &special = *iter->special_details;
         // If we haven't finished placing minimum instances of all specials,
@@ -4350,7 +4435,7 @@ void overmap::place_specials_pass( overmap_special_batch &enabled_specials,
                                    std::vector<point> &sectors, const bool place_optional )
 {
     // Walk over sectors in random order, to minimize "clumping".
-    std::random_shuffle( sectors.begin(), sectors.end() );
+    rng_shuffle( sectors.begin(), sectors.end() );
     for( auto it = sectors.begin(); it != sectors.end(); ) {
         const size_t attempts = 10;
         bool placed = false;
@@ -4407,6 +4492,12 @@ void overmap::place_specials( overmap_special_batch &enabled_specials )
                          return placement.instances_placed <
                                 placement.special_details->occurrences.min;
                      } ) ) {
+        if( pregenerating ) {
+            // Creating the next overmap needs the buffer, which can't be used from the
+            // background thread. The overmap will be generated again synchronously.
+            pregeneration_failed = true;
+            return;
+        }
         // Randomly select from among the nearest uninitialized overmap positions.
         int previous_distance = 0;
         std::vector<point> nearest_candidates;
@@ -4425,7 +4516,7 @@ void overmap::place_specials( overmap_special_batch &enabled_specials )
             }
         }
         if( !nearest_candidates.empty() ) {
-            std::random_shuffle( nearest_candidates.begin(), nearest_candidates.end() );
+            rng_shuffle( nearest_candidates.begin(), nearest_candidates.end() );
             point new_om_addr = nearest_candidates.front();
             overmap_buffer.create_custom_overmap( new_om_addr.x, new_om_addr.y, enabled_specials );
         } else {
@@ -4440,7 +4531,7 @@ void overmap::place_mongroups()
 {
     // Cities are full of zombies
     for( auto &elem : cities ) {
-        if( get_option<bool>( "WANDER_SPAWNS" ) ) {
+        if( gen_options.wander_spawns ) {
             if( !one_in( 16 ) || elem.s > 5 ) {
                 mongroup m( mongroup_id( "GROUP_ZOMBIE" ), ( elem.x * 2 ), ( elem.y * 2 ), 0, int( elem.s * 2.5 ),
                             elem.s * 80 );
@@ -4452,7 +4543,7 @@ void overmap::place_mongroups()
         }
     }
 
-    if (!get_option<bool>( "CLASSIC_ZOMBIES" ) ) {
+    if (!gen_options.classic_zombies ) {
         // Figure out where swamps are, and place swamp monsters
         for (int x = 3; x < OMAPX - 3; x += 7) {
             for (int y = 3; y < OMAPY - 3; y += 7) {
@@ -4471,7 +4562,7 @@ void overmap::place_mongroups()
         }
     }
 
-    if (!get_option<bool>( "CLASSIC_ZOMBIES" ) ) {
+    if (!gen_options.classic_zombies ) {
         // Figure out where rivers are, and place swamp monsters
         for (int x = 3; x < OMAPX - 3; x += 7) {
             for (int y = 3; y < OMAPY - 3; y += 7) {
@@ -4490,7 +4581,7 @@ void overmap::place_mongroups()
         }
     }
 
-    if (!get_option<bool>( "CLASSIC_ZOMBIES" ) ) {
+    if (!gen_options.classic_zombies ) {
         // Place the "put me anywhere" groups
         int numgroups = rng(0, 3);
         for (int i = 0; i < numgroups; i++) {
@@ -4680,7 +4771,7 @@ void overmap::add_mon_group(const mongroup &group)
     // makes the diffuse setting obsolete (as it only controls how the radius
     // is interpreted) - it's only used when adding monster groups with function.
     if( group.radius == 1 ) {
-        zg.insert(std::pair<tripoint, mongroup>( group.pos, group ) );
+        zg.insert( group );
         return;
     }
     // diffuse groups use a circular area, non-diffuse groups use a rectangular area
@@ -8,6 +8,7 @@
 #include "weighted_list.h"
 #include "game_constants.h"
 #include "monster.h"
+#include "mongroup.h"
 #include "weather_gen.h"
 
 #include <array>
@@ -192,7 +193,7 @@ struct radio_tower {
  int frequency;
 radio_tower(int X = -1, int Y = -1, int S = -1, std::string M = "",
             radio_type T = MESSAGE_BROADCAST) :
-    x (X), y (Y), strength (S), type (T), message (M) {frequency = rand();}
+    x (X), y (Y), strength (S), type (T), message (M) {frequency = rng( 0, RAND_MAX );}
 };
 
 struct map_layer {
@@ -280,6 +281,13 @@ class overmap
      */
     std::vector<point> find_terrain(const std::string &term, int zlevel);
 
+    /**
+     * Appends the (local) positions on the z-level whose terrain matches the type as
+     * @ref check_ot_type does. Uses an index of the terrain positions of the z-level,
+     * which is built the first time it's searched and kept up to date afterwards.
+     */
+    void find_ot_type( const std::string &otype, int z, std::vector<point> &result ) const;
+
     oter_id& ter(const int x, const int y, const int z);
     oter_id& ter( const tripoint &p );
     const oter_id get_ter(const int x, const int y, const int z) const;
@@ -375,8 +383,12 @@ class overmap
     overmap_special_batch get_enabled_specials() const;
 
     void clear_mon_groups();
+    /** Makes hordes near the position (in submaps, relative to this overmap) go there. */
+    void signal_hordes( const tripoint &p, int sig_power );
+    /** Moves hordes towards their target, called every few minutes. */
+    void move_hordes();
 private:
-    std::multimap<tripoint, mongroup> zg;
+    mongroup_map zg;
 public:
     /** Unit test enablers to check if a given mongroup is present. */
     bool mongroup_check(const mongroup &candidate) const;
@@ -411,9 +423,31 @@ public:
     bool nullbool = false;
     point loc{ 0, 0 };
 
+    /** Set while generated in the background, see @ref overmapbuffer::pregenerate. */
+    bool pregenerating = false;
+    /** Set when background generation needed other overmaps and has to be redone synchronously. */
+    bool pregeneration_failed = false;
+
     std::array<map_layer, OVERMAP_LAYERS> layer;
     std::unordered_map<tripoint, scent_trace> scents;
 
+    /** Where each terrain is on a z-level, see @ref find_ot_type. */
+    struct terrain_index {
+        bool built = false;
+        /** The terrain each position had when it was last indexed. */
+        std::vector<oter_id> indexed;
+        /** Local positions by the integer id of their terrain. */
+        std::unordered_map<int, std::vector<point>> positions;
+        /**
+         * Positions that @ref ter handed out a reference to, they may have been changed.
+         * Each position is listed once, @ref touched_at marks the listed ones.
+         */
+        std::vector<point> touched;
+        std::vector<bool> touched_at;
+    };
+    mutable std::array<terrain_index, OVERMAP_LAYERS> terrain_indices;
+    void update_terrain_index( int z ) const;
+
     /**
      * When monsters despawn during map-shifting they will be added here.
      * map::spawn_monsters will load them and place them into the reality bubble
@@ -423,6 +457,20 @@ public:
     std::unordered_multimap<tripoint, monster> monster_map;
     regional_settings settings;
 
+    /**
+     * The options and the world seed used by @ref generate. Like @ref settings they are
+     * read when the overmap is constructed on the main thread, generation may run on a
+     * worker thread (see @ref overmapbuffer::pregenerate).
+     */
+    struct generation_options {
+        unsigned int world_seed = 0;
+        int city_size = 0;
+        int city_spacing = 0;
+        bool wander_spawns = false;
+        bool classic_zombies = false;
+    };
+    generation_options gen_options;
+
     oter_id get_default_terrain( int z ) const;
 
     // Initialize
@@ -449,9 +497,7 @@ public:
 
     const city &get_nearest_city( const tripoint &p ) const;
 
-    void signal_hordes( const tripoint &p, int sig_power );
     void process_mongroups();
-    void move_hordes();
 
     static bool obsolete_terrain( const std::string &ter );
     void convert_terrain( const std::unordered_map<tripoint, std::string> &needs_conversion );
@@ -17,17 +17,46 @@
 #include "cata_utility.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
+#include <future>
 #include <sstream>
 #include <stdlib.h>
 
 overmapbuffer overmap_buffer;
 
+// Same order as overmap::open passes them to overmap::generate: north, east, south, west
+static const std::array<point, 4> neighbor_offsets = {{
+        point( 0, -1 ), point( 1, 0 ), point( 0, 1 ), point( -1, 0 )
+    }
+};
+
+struct overmapbuffer::pregeneration_job {
+    point pos;
+    std::unique_ptr<overmap> result;
+    overmap_special_batch specials;
+    /** Neighbours when the job was started, in the order overmap::generate takes them. */
+    std::array<const overmap *, 4> neighbors;
+    /** Copies of the neighbours, the originals may be changed while the job runs. */
+    std::array<std::unique_ptr<overmap>, 4> neighbor_copies;
+    /** Debug messages of the generation, shown when the result is added to the buffer. */
+    debug_message_buffer messages;
+    /** Last member: destroying it waits for the worker, before anything it uses is destroyed. */
+    std::future<void> done;
+
+    explicit pregeneration_job( const point &p ) : pos( p ), result( new overmap( p.x, p.y ) ),
+        specials( overmap_specials::get_default_batch( p ) ) {
+    }
+};
+
 overmapbuffer::overmapbuffer()
 : last_requested_overmap( nullptr )
 {
 }
 
+overmapbuffer::~overmapbuffer() = default;
+
 const city_reference city_reference::invalid{ nullptr, tripoint(), -1 };
 
 int city_reference::get_distance_from_bounds() const {
@@ -67,6 +96,14 @@ overmap &overmapbuffer::get( const int x, const int y )
         return *( last_requested_overmap = it->second.get() );
     }
 
+    if( pregeneration && pregeneration->pos == p ) {
+        finish_pregeneration( true );
+        auto const pregenerated = overmaps.find( p );
+        if( pregenerated != overmaps.end() ) {
+            return *( last_requested_overmap = pregenerated->second.get() );
+        }
+    }
+
     // That constructor loads an existing overmap or creates a new one.
     overmap *new_om = new overmap( x, y );
     overmaps[ p ] = std::unique_ptr<overmap>( new_om );
@@ -93,14 +130,100 @@ void overmapbuffer::create_custom_overmap( int const x, int const y, overmap_spe
     new_om->populate( specials );
 }
 
+void overmapbuffer::pregenerate( const point &om )
+{
+    if( pregeneration || get_existing( om.x, om.y ) != nullptr ) {
+        return;
+    }
+    std::unique_ptr<pregeneration_job> job( new pregeneration_job( om ) );
+    for( size_t i = 0; i < neighbor_offsets.size(); i++ ) {
+        job->neighbors[i] = get_existing( om.x + neighbor_offsets[i].x, om.y + neighbor_offsets[i].y );
+        if( job->neighbors[i] != nullptr ) {
+            job->neighbor_copies[i].reset( new overmap( *job->neighbors[i] ) );
+        }
+    }
+    job->result->pregenerating = true;
+
+    pregeneration_job *const j = job.get();
+    j->done = std::async( std::launch::async, [j]() {
+        const debug_message_buffer::capture deferred_messages( j->messages );
+        j->result->generate( j->neighbor_copies[0].get(), j->neighbor_copies[1].get(),
+                             j->neighbor_copies[2].get(), j->neighbor_copies[3].get(), j->specials );
+    } );
+    pregeneration = std::move( job );
+}
+
+void overmapbuffer::finish_pregeneration( const bool wait )
+{
+    if( !pregeneration ) {
+        return;
+    }
+    if( !wait &&
+        pregeneration->done.wait_for( std::chrono::seconds( 0 ) ) != std::future_status::ready ) {
+        return;
+    }
+    const std::unique_ptr<pregeneration_job> job = std::move( pregeneration );
+    try {
+        job->done.get();
+    } catch( const std::exception &err ) {
+        // Dropped, generating it synchronously will report the error.
+        DebugLog( D_WARNING, D_MAP_GEN ) << "pregenerating overmap (" << job->pos.x << "," << job->pos.y <<
+                                         ") failed: " << err.what();
+        return;
+    }
+    if( job->result->pregeneration_failed || overmaps.count( job->pos ) > 0 ) {
+        return;
+    }
+    for( size_t i = 0; i < neighbor_offsets.size(); i++ ) {
+        if( get_existing( job->pos.x + neighbor_offsets[i].x,
+                          job->pos.y + neighbor_offsets[i].y ) != job->neighbors[i] ) {
+            return;
+        }
+    }
+
+    // Only now, a dropped result is generated again and reports its messages then
+    job->messages.replay();
+    overmap *new_om = job->result.release();
+    new_om->pregenerating = false;
+    overmaps[ job->pos ] = std::unique_ptr<overmap>( new_om );
+    fix_mongroups( *new_om );
+    fix_npcs( *new_om );
+}
+
+void overmapbuffer::process_pregeneration( const tripoint &omt_pos )
+{
+    finish_pregeneration( false );
+    if( pregeneration ) {
+        return;
+    }
+    // Distance (in overmap terrain) to the border at which the next overmap is started.
+    // It takes some real time to generate, even when driving fast.
+    static const int pregeneration_distance = OMAPX / 4;
+    int x = omt_pos.x;
+    int y = omt_pos.y;
+    const point om = omt_to_om_remain( x, y );
+    const int dx = x < pregeneration_distance ? -1 : x >= OMAPX - pregeneration_distance ? 1 : 0;
+    const int dy = y < pregeneration_distance ? -1 : y >= OMAPY - pregeneration_distance ? 1 : 0;
+    // Straight ahead first, the diagonal one is only needed when near a corner.
+    for( const point &d : { point( dx, 0 ), point( 0, dy ), point( dx, dy ) } ) {
+        if( d.x == 0 && d.y == 0 ) {
+            continue;
+        }
+        pregenerate( point( om.x + d.x, om.y + d.y ) );
+        if( pregeneration ) {
+            return;
+        }
+    }
+}
+
 void overmapbuffer::fix_mongroups(overmap &new_overmap)
 {
     for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
-        auto &mg = it->second;
+        auto &mg = *it;
         // spawn related code simply sets population to 0 when they have been
         // transformed into spawn points on a submap, the group can then be removed
         if( mg.empty() ) {
-            new_overmap.zg.erase( it++ );
+            it = new_overmap.zg.erase( it );
             continue;
         }
         // Inside the bounds of the overmap?
@@ -118,10 +241,11 @@ void overmapbuffer::fix_mongroups(overmap &new_overmap)
             continue;
         }
         overmap &om = get( omp.x, omp.y );
-        mg.pos.x = smabs.x;
-        mg.pos.y = smabs.y;
-        om.add_mon_group( mg );
-        new_overmap.zg.erase( it++ );
+        mongroup moved = mg;
+        moved.pos.x = smabs.x;
+        moved.pos.y = smabs.y;
+        om.add_mon_group( moved );
+        it = new_overmap.zg.erase( it );
     }
 }
 
@@ -185,6 +309,7 @@ void overmapbuffer::save()
 
 void overmapbuffer::clear()
 {
+    pregeneration.reset();
     overmaps.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
@@ -416,12 +541,11 @@ std::vector<mongroup*> overmapbuffer::groups_at(int x, int y, int z)
     }
     const tripoint dpos( x, y, z );
     overmap &om = get( omp.x, omp.y );
-    for( auto it = om.zg.lower_bound( dpos ), end = om.zg.upper_bound( dpos ); it != end; ++it ) {
-        auto &mg = it->second;
-        if( mg.empty() ) {
+    for( mongroup *mg : om.zg.groups_at( dpos ) ) {
+        if( mg->empty() ) {
             continue;
         }
-        result.push_back( &mg );
+        result.push_back( mg );
     }
     return result;
 }
@@ -619,51 +743,53 @@ tripoint overmapbuffer::find_closest(const tripoint& origin, const std::string&
     // The actual number is 5 because 1 covers the current overmap,
     // and each additional one expends the search to the next concentric circle of overmaps.
 
-    int max = ( radius == 0 ? OMAPX * 5 : radius );
+    const int max = ( radius == 0 ? OMAPX * 5 : radius );
     const int z = origin.z;
-    // expanding box
-    for( int dist = 0; dist <= max; dist++) {
-        // each edge length is 2*dist-2, because corners belong to one edge
-        // south is +y, north is -y
-        for (int i = 0; i < dist*2-1; i++) {
-            //start at northwest, scan north edge
-            int x = origin.x - dist + i;
-            int y = origin.y - dist;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
+    // Overmaps that overlap the search area, by the distance of their closest point from
+    // the origin. They are searched in that order, until none of the remaining ones can
+    // contain anything closer than what has been found already. Like the expanding box
+    // this used to be, overmaps further away than the result are not created.
+    const point origin_om = omt_to_om_copy( origin.x, origin.y );
+    const int om_radius = max / OMAPX + 1;
+    std::vector<std::pair<int, point>> candidates;
+    for( int x = origin_om.x - om_radius; x <= origin_om.x + om_radius; x++ ) {
+        for( int y = origin_om.y - om_radius; y <= origin_om.y + om_radius; y++ ) {
+            const point base( x * OMAPX, y * OMAPY );
+            const int dx = std::max( { base.x - origin.x, origin.x - ( base.x + OMAPX - 1 ), 0 } );
+            const int dy = std::max( { base.y - origin.y, origin.y - ( base.y + OMAPY - 1 ), 0 } );
+            const int dist = std::max( dx, dy );
+            if( dist <= max ) {
+                candidates.emplace_back( dist, point( x, y ) );
             }
-
-            //start at southeast, scan south
-            x = origin.x + dist - i;
-            y = origin.y + dist;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
-            }
-
-            //start at southwest, scan west
-            x = origin.x - dist;
-            y = origin.y + dist - i;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
+        }
+    }
+    std::sort( candidates.begin(), candidates.end() );
+
+    tripoint result = overmap::invalid_tripoint;
+    int result_dist = max + 1;
+    std::vector<point> found;
+    for( const auto &candidate : candidates ) {
+        if( candidate.first >= result_dist ) {
+            break;
+        }
+        overmap &om = get( candidate.second.x, candidate.second.y );
+        const point base = om.global_base_point();
+        found.clear();
+        om.find_ot_type( type, z, found );
+        for( const point &p : found ) {
+            const int dist = square_dist( origin.x, origin.y, base.x + p.x, base.y + p.y );
+            // The origin itself is not a result.
+            if( dist == 0 || dist >= result_dist ) {
+                continue;
             }
-
-            //start at northeast, scan east
-            x = origin.x + dist;
-            y = origin.y - dist + i;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
+            if( must_be_seen && !om.seen( p.x, p.y, z ) ) {
+                continue;
             }
+            result = tripoint( base.x + p.x, base.y + p.y, z );
+            result_dist = dist;
         }
     }
-    return overmap::invalid_tripoint;
+    return result;
 }
 
 std::vector<tripoint> overmapbuffer::find_all( const tripoint& origin, const std::string& type,
@@ -672,16 +798,29 @@ std::vector<tripoint> overmapbuffer::find_all( const tripoint& origin, const std
     std::vector<tripoint> result;
     // dist == 0 means search a whole overmap diameter.
     dist = dist ? dist : OMAPX;
-    for (int x = origin.x - dist; x <= origin.x + dist; x++) {
-        for (int y = origin.y - dist; y <= origin.y + dist; y++) {
-            if (must_be_seen && !seen(x, y, origin.z)) {
-                continue;
-            }
-            if (check_ot_type(type, x, y, origin.z)) {
-                result.push_back( tripoint( x, y, origin.z ) );
+    const point min_om = omt_to_om_copy( origin.x - dist, origin.y - dist );
+    const point max_om = omt_to_om_copy( origin.x + dist, origin.y + dist );
+    std::vector<point> found;
+    for( int x = min_om.x; x <= max_om.x; x++ ) {
+        for( int y = min_om.y; y <= max_om.y; y++ ) {
+            overmap &om = get( x, y );
+            const point base = om.global_base_point();
+            found.clear();
+            om.find_ot_type( type, origin.z, found );
+            for( const point &p : found ) {
+                const tripoint pos( base.x + p.x, base.y + p.y, origin.z );
+                if( std::abs( pos.x - origin.x ) > dist || std::abs( pos.y - origin.y ) > dist ) {
+                    continue;
+                }
+                if( must_be_seen && !om.seen( p.x, p.y, origin.z ) ) {
+                    continue;
+                }
+                result.push_back( pos );
             }
         }
     }
+    // Same order as scanning the area row by row, callers may pick from it randomly.
+    std::sort( result.begin(), result.end() );
     return result;
 }
 
@@ -59,6 +59,7 @@ class overmapbuffer
 {
 public:
     overmapbuffer();
+    ~overmapbuffer();
 
     static std::string terrain_filename(int const x, int const y);
     static std::string player_filename(int const x, int const y);
@@ -72,6 +73,26 @@ public:
     void clear();
     void create_custom_overmap( int const x, int const y, overmap_special_batch &specials );
 
+    /**
+     * Starts generating the overmap at the given overmap coordinates on a worker thread,
+     * unless it already exists (in memory or on disk) or another one is being generated.
+     * The finished overmap is added by @ref process_pregeneration, or by @ref get when it
+     * is requested earlier (which then waits for it).
+     * Overmap generation only depends on the world seed, the position and the neighbouring
+     * overmaps, so the result is the same as when generated synchronously. If a neighbour
+     * appeared in the mean time, the result is dropped and generated again when needed.
+     * The worker only uses copies of the neighbours, and the options and regional settings
+     * the overmap read when it was constructed here. Its debug messages are kept and shown
+     * when the result is added.
+     */
+    void pregenerate( const point &om );
+    /**
+     * Adds a finished background overmap, and starts generating the overmaps next to the
+     * one containing the given position (global overmap terrain coordinates) when the
+     * position is near their border.
+     */
+    void process_pregeneration( const tripoint &omt_pos );
+
     /**
      * Uses global overmap terrain coordinates, creates the
      * overmap if needed.
@@ -353,6 +374,15 @@ private:
     // Cached result of previous call to overmapbuffer::get_existing
     overmap mutable *last_requested_overmap;
 
+    struct pregeneration_job;
+    /** The overmap being generated in the background, see @ref pregenerate. */
+    std::unique_ptr<pregeneration_job> pregeneration;
+    /**
+     * Adds the overmap of the background job to the buffer if it has finished (or waits
+     * for it if @p wait is true), unless it had to be dropped.
+     */
+    void finish_pregeneration( bool wait );
+
     /**
      * Get a list of notes in the (loaded) overmaps.
      * @param z only this specific z-level is search for notes.
@@ -92,8 +92,11 @@ const mtype_id mon_player_blob( "mon_player_blob" );
 const mtype_id mon_shadow_snake( "mon_shadow_snake" );
 
 const skill_id skill_dodge( "dodge" );
+const skill_id skill_driving( "driving" );
 const skill_id skill_gun( "gun" );
 const skill_id skill_mechanics( "mechanics" );
+const skill_id skill_melee( "melee" );
+const skill_id skill_speech( "speech" );
 const skill_id skill_swimming( "swimming" );
 const skill_id skill_throw( "throw" );
 const skill_id skill_unarmed( "unarmed" );
@@ -209,6 +212,7 @@ static const bionic_id bio_reactor( "bio_reactor" );
 static const bionic_id bio_recycler( "bio_recycler" );
 static const bionic_id bio_shakes( "bio_shakes" );
 static const bionic_id bio_sleepy( "bio_sleepy" );
+static const bionic_id bio_sunglasses( "bio_sunglasses" );
 static const bionic_id bn_bio_solar( "bn_bio_solar" );
 static const bionic_id bio_spasm( "bio_spasm" );
 static const bionic_id bio_speed( "bio_speed" );
@@ -263,6 +267,7 @@ static const trait_id trait_DEBUG_HS( "DEBUG_HS" );
 static const trait_id trait_DEBUG_LS( "DEBUG_LS" );
 static const trait_id trait_DEBUG_NODMG( "DEBUG_NODMG" );
 static const trait_id trait_DEBUG_NOTEMP( "DEBUG_NOTEMP" );
+static const trait_id trait_DEBUG_STORAGE( "DEBUG_STORAGE" );
 static const trait_id trait_DEFORMED( "DEFORMED" );
 static const trait_id trait_DEFORMED2( "DEFORMED2" );
 static const trait_id trait_DEFORMED3( "DEFORMED3" );
@@ -291,6 +296,7 @@ static const trait_id trait_GOODHEARING( "GOODHEARING" );
 static const trait_id trait_GOODMEMORY( "GOODMEMORY" );
 static const trait_id trait_HEAVYSLEEPER( "HEAVYSLEEPER" );
 static const trait_id trait_HEAVYSLEEPER2( "HEAVYSLEEPER2" );
+static const trait_id trait_HIBERNATE( "HIBERNATE" );
 static const trait_id trait_HOARDER( "HOARDER" );
 static const trait_id trait_HOLLOW_BONES( "HOLLOW_BONES" );
 static const trait_id trait_HOOVES( "HOOVES" );
@@ -407,10 +413,43 @@ static const trait_id trait_WEB_WEAVER( "WEB_WEAVER" );
 static const trait_id trait_WHISKERS( "WHISKERS" );
 static const trait_id trait_WHISKERS_RAT( "WHISKERS_RAT" );
 static const trait_id trait_WINGS_BUTTERFLY( "WINGS_BUTTERFLY" );
+static const trait_id trait_WINGS_INSECT( "WINGS_INSECT" );
 static const trait_id trait_WOOLALLERGY( "WOOLALLERGY" );
 
 static const itype_id OPTICAL_CLOAK_ITEM_ID( "optical_cloak" );
 
+static const material_id mat_bone( "bone" );
+static const material_id mat_chitin( "chitin" );
+static const material_id mat_cotton( "cotton" );
+static const material_id mat_leather( "leather" );
+static const material_id mat_nomex( "nomex" );
+static const material_id mat_plastic( "plastic" );
+static const material_id mat_wool( "wool" );
+
+static const flag_id flag_ALLOWS_NATURAL_ATTACKS( "ALLOWS_NATURAL_ATTACKS" );
+static const flag_id flag_ALWAYS_TWOHAND( "ALWAYS_TWOHAND" );
+static const flag_id flag_BELTED( "BELTED" );
+static const flag_id flag_FRAGILE( "FRAGILE" );
+static const flag_id flag_HELMET_COMPAT( "HELMET_COMPAT" );
+static const flag_id flag_INSPIRATIONAL( "INSPIRATIONAL" );
+static const flag_id flag_INSTALL_DIFFICULT( "INSTALL_DIFFICULT" );
+static const flag_id flag_MAG_BULKY( "MAG_BULKY" );
+static const flag_id flag_NO_RELOAD( "NO_RELOAD" );
+static const flag_id flag_NO_UNLOAD( "NO_UNLOAD" );
+static const flag_id flag_NO_UNWIELD( "NO_UNWIELD" );
+static const flag_id flag_OUTER( "OUTER" );
+static const flag_id flag_OVERSIZE( "OVERSIZE" );
+static const flag_id flag_RADIO_ACTIVATION( "RADIO_ACTIVATION" );
+static const flag_id flag_RAIN_PROTECT( "RAIN_PROTECT" );
+static const flag_id flag_RELOAD_AND_SHOOT( "RELOAD_AND_SHOOT" );
+static const flag_id flag_RELOAD_ONE( "RELOAD_ONE" );
+static const flag_id flag_RESTRICT_HANDS( "RESTRICT_HANDS" );
+static const flag_id flag_SKINTIGHT( "SKINTIGHT" );
+static const flag_id flag_SPEEDLOADER( "SPEEDLOADER" );
+static const flag_id flag_STR_RELOAD( "STR_RELOAD" );
+static const flag_id flag_STURDY( "STURDY" );
+static const flag_id flag_USE_UPS( "USE_UPS" );
+
 stat_mod player::get_pain_penalty() const
 {
     stat_mod ret;
@@ -702,15 +741,12 @@ void player::reset_stats()
     }
 
     // Effects
-    for( auto maps : *effects ) {
-        for( auto i : maps.second ) {
-            const auto &it = i.second;
-            bool reduced = resists_effect( it );
-            mod_str_bonus( it.get_mod( "STR", reduced ) );
-            mod_dex_bonus( it.get_mod( "DEX", reduced ) );
-            mod_per_bonus( it.get_mod( "PER", reduced ) );
-            mod_int_bonus( it.get_mod( "INT", reduced ) );
-        }
+    for( const effect &it : *effects ) {
+        bool reduced = resists_effect( it );
+        mod_str_bonus( it.get_mod( "STR", reduced ) );
+        mod_dex_bonus( it.get_mod( "DEX", reduced ) );
+        mod_per_bonus( it.get_mod( "PER", reduced ) );
+        mod_int_bonus( it.get_mod( "INT", reduced ) );
     }
 
     Character::reset_stats();
@@ -1726,7 +1762,7 @@ void player::recalc_speed_bonus()
 {
     // Minus some for weight...
     int carry_penalty = 0;
-    if( weight_carried() > weight_capacity() && !has_trait( trait_id( "DEBUG_STORAGE" ) ) ) {
+    if( weight_carried() > weight_capacity() && !has_trait( trait_DEBUG_STORAGE ) ) {
         carry_penalty = 25 * ( weight_carried() - weight_capacity() ) / ( weight_capacity() );
     }
     mod_speed_bonus( -carry_penalty );
@@ -1740,11 +1776,9 @@ void player::recalc_speed_bonus()
         mod_speed_bonus( hunger_speed_penalty( get_hunger() ) );
     }
 
-    for( auto maps : *effects ) {
-        for( auto i : maps.second ) {
-            bool reduced = resists_effect( i.second );
-            mod_speed_bonus( i.second.get_mod( "SPEED", reduced ) );
-        }
+    for( const effect &it : *effects ) {
+        bool reduced = resists_effect( it );
+        mod_speed_bonus( it.get_mod( "SPEED", reduced ) );
     }
 
     // add martial arts speed bonus
@@ -1845,7 +1879,7 @@ int player::run_cost( int base_cost, bool diag ) const
     if( has_trait( trait_HOLLOW_BONES ) ) {
         movecost *= .8f;
     }
-    if( has_active_mutation( trait_id( "WINGS_INSECT" ) ) ) {
+    if( has_active_mutation( trait_WINGS_INSECT ) ) {
         movecost *= .75f;
     }
     if( has_trait( trait_WINGS_BUTTERFLY ) ) {
@@ -2115,7 +2149,7 @@ nc_color player::basic_symbol_color() const
     if( has_effect( effect_boomered ) ) {
         return c_pink;
     }
-    if( has_active_mutation( trait_id( "SHELL2" ) ) ) {
+    if( has_active_mutation( trait_SHELL2 ) ) {
         return c_magenta;
     }
     if( underwater ) {
@@ -2609,19 +2643,19 @@ std::list<item *> player::get_radio_items()
     const invslice &stacks = inv.slice();
     for( auto &stack : stacks ) {
         item &stack_iter = stack->front();
-        if( stack_iter.has_flag( "RADIO_ACTIVATION" ) ) {
+        if( stack_iter.has_flag( flag_RADIO_ACTIVATION ) ) {
             rc_items.push_back( &stack_iter );
         }
     }
 
     for( auto &elem : worn ) {
-        if( elem.has_flag( "RADIO_ACTIVATION" ) ) {
+        if( elem.has_flag( flag_RADIO_ACTIVATION ) ) {
             rc_items.push_back( &elem );
         }
     }
 
     if( is_armed() ) {
-        if( weapon.has_flag( "RADIO_ACTIVATION" ) ) {
+        if( weapon.has_flag( flag_RADIO_ACTIVATION ) ) {
             rc_items.push_back( &weapon );
         }
     }
@@ -2801,7 +2835,7 @@ bool player::has_two_arms() const
     // If you've got a blaster arm, low hp arm, or you're inside a shell then you don't have two
     // arms to use.
     return !( ( has_bionic( bio_blaster ) || hp_cur[hp_arm_l] < 10 || hp_cur[hp_arm_r] < 10 ) ||
-              has_active_mutation( trait_id( "SHELL2" ) ) );
+              has_active_mutation( trait_SHELL2 ) );
 }
 
 bool player::avoid_trap( const tripoint &pos, const trap &tr ) const
@@ -2922,7 +2956,7 @@ void player::pause()
                 if( exp_temp - experience > 0 && x_in_y( exp_temp - experience, 1.0 ) ) {
                     experience++;
                 }
-                practice( skill_id( "driving" ), experience );
+                practice( skill_driving, experience );
             }
             break;
         }
@@ -3097,7 +3131,7 @@ int player::talk_skill() const
     /** @EFFECT_PER slightly increases talking skill */
 
     /** @EFFECT_SPEECH increases talking skill */
-    int ret = get_int() + get_per() + get_skill_level( skill_id( "speech" ) ) * 3;
+    int ret = get_int() + get_per() + get_skill_level( skill_speech ) * 3;
     if (has_trait( trait_SAPIOVORE )) {
         ret -= 20; // Friendly conversation with your prey? unlikely
     } else if (has_trait( trait_UGLY )) {
@@ -3195,7 +3229,7 @@ void player::on_hit( Creature *source, body_part bp_hit,
     }
 
     bool u_see = g->u.sees( *this );
-    if( has_active_bionic( bionic_id( "bio_ods" ) ) && power_level > 5 ) {
+    if( has_active_bionic( bio_ods ) && power_level > 5 ) {
         if( is_player() ) {
             add_msg( m_good, _( "Your offensive defense system shocks %s in mid-attack!" ),
                              source->disp_name().c_str());
@@ -4376,7 +4410,7 @@ bool player::is_hibernating() const
     // a little, and came out of it well into Parched.  Hibernating shouldn't endanger your
     // life like that--but since there's much less fluid reserve than food reserve,
     // simply using the same numbers won't work.
-    return has_effect( effect_sleep ) && get_hunger() <= -60 && get_thirst() <= 80 && has_active_mutation( trait_id( "HIBERNATE" ) );
+    return has_effect( effect_sleep ) && get_hunger() <= -60 && get_thirst() <= 80 && has_active_mutation( trait_HIBERNATE );
 }
 
 void player::add_addiction(add_type type, int strength)
@@ -4827,9 +4861,11 @@ void player::process_effects() {
     }
 
     //Human only effects
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            process_one_effect( _effect_it.second, false );
+    // Processing an effect may add or remove others, so look each one up again.
+    for( const auto &key : effects->keys() ) {
+        effect *e = effects->find( key.first, key.second );
+        if( e != nullptr ) {
+            process_one_effect( *e, false );
         }
     }
 
@@ -4939,7 +4975,7 @@ void player::suffer()
         }
     }
 
-    if( has_active_mutation( trait_id( "WINGS_INSECT" ) ) ) {
+    if( has_active_mutation( trait_WINGS_INSECT ) ) {
         //~Sound of buzzing Insect Wings
         sounds::sound( pos(), 10, _("BZZZZZ"));
     }
@@ -4973,7 +5009,7 @@ void player::suffer()
     }
 
     if( !in_sleep_state() ) {
-        if ( !has_trait( trait_id( "DEBUG_STORAGE" ) ) && ( weight_carried() > 4 * weight_capacity() ) ) {
+        if ( !has_trait( trait_DEBUG_STORAGE ) && ( weight_carried() > 4 * weight_capacity() ) ) {
             if( has_effect( effect_downed ) ) {
                 add_effect( effect_downed, 1_turns, num_bp, false, 0, true );
             } else {
@@ -5210,7 +5246,7 @@ void player::suffer()
     if( ( has_trait( trait_ALBINO ) || has_effect( effect_datura ) ) &&
         g->is_in_sunlight( pos() ) && one_in(10) ) {
         // Umbrellas can keep the sun off the skin and sunglasses - off the eyes.
-        if( !weapon.has_flag( "RAIN_PROTECT" ) ) {
+        if( !weapon.has_flag( flag_RAIN_PROTECT ) ) {
             add_msg_if_player( m_bad, _( "The sunlight is really irritating your skin." ) );
             if( in_sleep_state() ) {
                 wake_up();
@@ -5221,7 +5257,7 @@ void player::suffer()
             else focus_pool --;
         }
         if( !( ( (worn_with_flag( "SUN_GLASSES" ) ) || worn_with_flag( "BLIND" ) ) && ( wearing_something_on( bp_eyes ) ) )
-            && !has_bionic( bionic_id( "bio_sunglasses" ) ) ) {
+            && !has_bionic( bio_sunglasses ) ) {
             add_msg_if_player( m_bad, _( "The sunlight is really irritating your eyes." ) );
             if( one_in(10) ) {
                 mod_pain(1);
@@ -5231,7 +5267,7 @@ void player::suffer()
     }
 
     if (has_trait( trait_SUNBURN ) && g->is_in_sunlight(pos()) && one_in(10)) {
-        if( !( weapon.has_flag( "RAIN_PROTECT" ) ) ) {
+        if( !( weapon.has_flag( flag_RAIN_PROTECT ) ) ) {
             add_msg_if_player(m_bad, _("The sunlight burns your skin!"));
         if (in_sleep_state()) {
             wake_up();
@@ -5836,14 +5872,11 @@ void player::vomit()
     }
 
     moves -= 100;
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            if( it.get_id() == effect_foodpoison ) {
-                it.mod_duration( -30_minutes );
-            } else if( it.get_id() == effect_drunk ) {
-                it.mod_duration( rng( -10_minutes, -50_minutes ) );
-            }
+    for( effect &it : *effects ) {
+        if( it.get_id() == effect_foodpoison ) {
+            it.mod_duration( -30_minutes );
+        } else if( it.get_id() == effect_drunk ) {
+            it.mod_duration( rng( -10_minutes, -50_minutes ) );
         }
     }
     remove_effect( effect_pkill1 );
@@ -5862,7 +5895,7 @@ void player::drench( int saturation, const body_part_set &flags, bool ignore_wat
     }
 
     // OK, water gets in your AEP suit or whatever.  It wasn't built to keep you dry.
-    if( has_trait( trait_DEBUG_NOTEMP ) || has_active_mutation( trait_id( "SHELL2" ) ) ||
+    if( has_trait( trait_DEBUG_NOTEMP ) || has_active_mutation( trait_SHELL2 ) ||
         ( !ignore_waterproof && is_waterproof(flags) ) ) {
         return;
     }
@@ -6110,11 +6143,8 @@ void player::check_and_recover_morale()
         test_morale.on_mutation_gain( mut.first );
     }
 
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            const effect &e = _effect_it.second;
-            test_morale.on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
-        }
+    for( const effect &e : *effects ) {
+        test_morale.on_effect_int_change( e.get_id(), e.get_intensity(), e.get_bp() );
     }
 
     test_morale.on_stat_change( "hunger", get_hunger() );
@@ -6204,7 +6234,7 @@ void player::process_active_items()
     long ch_UPS_used = 0;
     for( size_t i = 0; i < inv.size() && ch_UPS_used < ch_UPS; i++ ) {
         item &it = inv.find_item(i);
-        if( !it.has_flag( "USE_UPS" ) ) {
+        if( !it.has_flag( flag_USE_UPS ) ) {
             continue;
         }
         if( it.charges < it.type->maximum_charges() ) {
@@ -6212,7 +6242,7 @@ void player::process_active_items()
             it.charges++;
         }
     }
-    if( weapon.has_flag( "USE_UPS" ) &&  ch_UPS_used < ch_UPS &&
+    if( weapon.has_flag( flag_USE_UPS ) &&  ch_UPS_used < ch_UPS &&
         weapon.charges < weapon.type->maximum_charges() ) {
         ch_UPS_used++;
         weapon.charges++;
@@ -6222,7 +6252,7 @@ void player::process_active_items()
         if( ch_UPS_used >= ch_UPS ) {
             break;
         }
-        if( !worn_item.has_flag( "USE_UPS" ) ) {
+        if( !worn_item.has_flag( flag_USE_UPS ) ) {
             continue;
         }
         if( worn_item.charges < worn_item.type->maximum_charges() ) {
@@ -6525,7 +6555,7 @@ std::list<item> player::use_charges( const itype_id& what, long qty )
         if( e->use_charges( what, qty, res, pos() ) ) {
             del.push_back( e );
         }
-        if( e->typeId() == what && e->has_flag( "USE_UPS" ) ) {
+        if( e->typeId() == what && e->has_flag( flag_USE_UPS ) ) {
             has_tool_with_UPS = true;
         }
         return qty > 0 ? VisitResponse::SKIP : VisitResponse::ABORT;
@@ -6960,7 +6990,7 @@ item::reload_option player::select_ammo( const item &base, std::vector<item::rel
                 }
                 return false;
             }
-    } cb( opts, draw_row, last_key, default_to, !base.has_flag( "RELOAD_ONE" ) );
+    } cb( opts, draw_row, last_key, default_to, !base.has_flag( flag_RELOAD_ONE ) );
     menu.callback = &cb;
 
     menu.query();
@@ -7000,11 +7030,11 @@ item::reload_option player::select_ammo( const item& base, bool prompt ) const
                 : ammo->typeId();
             if( e->can_reload_with( id ) ) {
                 // Speedloaders require an empty target.
-                if( !ammo->has_flag( "SPEEDLOADER" ) || e->ammo_remaining() < 1 ) {
+                if( !ammo->has_flag( flag_SPEEDLOADER ) || e->ammo_remaining() < 1 ) {
                     ammo_match_found = true;
                 }
             }
-            if( can_reload( *e, id ) || e->has_flag( "RELOAD_AND_SHOOT" ) ) {
+            if( can_reload( *e, id ) || e->has_flag( flag_RELOAD_AND_SHOOT ) ) {
                 ammo_list.emplace_back( this, e, &base, std::move( ammo ) );
             }
         }
@@ -7054,7 +7084,7 @@ item::reload_option player::select_ammo( const item& base, bool prompt ) const
         } else if( base.magazine_integral() && base.ammo_remaining() > 0 ) {
             return std::move( ammo_list[ 0 ] ); // adding to partially filled integral magazines
 
-        } else if( base.has_flag( "RELOAD_AND_SHOOT" ) && has_item( *ammo_list[ 0 ].ammo ) ) {
+        } else if( base.has_flag( flag_RELOAD_AND_SHOOT ) && has_item( *ammo_list[ 0 ].ammo ) ) {
             return std::move( ammo_list[ 0 ] ); // using bows etc and ammo is already in player possession
         }
     }
@@ -7105,7 +7135,7 @@ ret_val<bool> player::can_wear( const item& it  ) const
     }
 
     // Check if we don't have both hands available before wearing a briefcase, shield, etc. Also occurs if we're already wearing one.
-    if( it.has_flag( "RESTRICT_HANDS" ) && ( !has_two_arms() || worn_with_flag( "RESTRICT_HANDS" ) || weapon.is_two_handed( *this ) ) ) {
+    if( it.has_flag( flag_RESTRICT_HANDS ) && ( !has_two_arms() || worn_with_flag( "RESTRICT_HANDS" ) || weapon.is_two_handed( *this ) ) ) {
         return ret_val<bool>::make_failure( ( is_player() ? _( "You don't have a hand free to wear that." )
                                               : string_format( _( "%s doesn't have a hand free to wear that." ), name.c_str() ) ) );
     }
@@ -7117,17 +7147,17 @@ ret_val<bool> player::can_wear( const item& it  ) const
 
     if( ( ( it.covers( bp_foot_l ) && is_wearing_shoes( "left" ) ) ||
           ( it.covers( bp_foot_r ) && is_wearing_shoes( "right") ) ) &&
-          ( !it.has_flag( "OVERSIZE" ) || !it.has_flag( "OUTER" ) ) &&
-          !it.has_flag( "SKINTIGHT" ) && !it.has_flag( "BELTED" ) ) {
+          ( !it.has_flag( flag_OVERSIZE ) || !it.has_flag( flag_OUTER ) ) &&
+          !it.has_flag( flag_SKINTIGHT ) && !it.has_flag( flag_BELTED ) ) {
         // Checks to see if the player is wearing shoes
         return ret_val<bool>::make_failure( ( is_player() ? _( "You're already wearing footwear!" )
                                               : string_format( _( "%s is already wearing footwear!" ), name.c_str() ) ) );
     }
 
     if( it.covers( bp_head ) &&
-        !it.has_flag( "HELMET_COMPAT" ) &&
-        !it.has_flag( "SKINTIGHT" ) &&
-        !it.has_flag( "OVERSIZE" ) &&
+        !it.has_flag( flag_HELMET_COMPAT ) &&
+        !it.has_flag( flag_SKINTIGHT ) &&
+        !it.has_flag( flag_OVERSIZE ) &&
         is_wearing_helmet() ) {
         return ret_val<bool>::make_failure( wearing_something_on( bp_head ),
                                             ( is_player() ? _( "You can't wear that with other headgear!" )
@@ -7135,13 +7165,13 @@ ret_val<bool> player::can_wear( const item& it  ) const
     }
 
     if( it.covers( bp_head ) &&
-        ( it.has_flag( "SKINTIGHT" ) || it.has_flag( "HELMET_COMPAT" ) ) &&
+        ( it.has_flag( flag_SKINTIGHT ) || it.has_flag( flag_HELMET_COMPAT ) ) &&
         ( head_cloth_encumbrance() + it.get_encumber() > 20 ) ) {
         return ret_val<bool>::make_failure( ( is_player() ? _( "You can't wear that much on your head!" )
                                               : string_format( _( "%s can't wear that much on their head!" ), name.c_str() ) ) );
     }
 
-    if( has_trait( trait_WOOLALLERGY ) && ( it.made_of( material_id( "wool" ) ) || it.item_tags.count( "wooled" ) ) ) {
+    if( has_trait( trait_WOOLALLERGY ) && ( it.made_of( mat_wool ) || it.item_tags.count( "wooled" ) ) ) {
         return ret_val<bool>::make_failure( _( "Can't wear that, it's made of wool!" ) );
     }
 
@@ -7149,7 +7179,7 @@ ret_val<bool> player::can_wear( const item& it  ) const
         return ret_val<bool>::make_failure( _( "Can't wear that, it's filthy!" ) );
     }
 
-    if( !it.has_flag( "OVERSIZE" ) ) {
+    if( !it.has_flag( flag_OVERSIZE ) ) {
         for( const trait_id &mut : get_mutations() ) {
             const auto &branch = mut.obj();
             if( branch.conflicts_with_item( it ) ) {
@@ -7158,8 +7188,8 @@ ret_val<bool> player::can_wear( const item& it  ) const
             }
         }
         if( it.covers(bp_head) &&
-            !it.made_of( material_id( "wool" ) ) && !it.made_of( material_id( "cotton" ) ) &&
-            !it.made_of( material_id( "nomex" ) ) && !it.made_of( material_id( "leather" ) ) &&
+            !it.made_of( mat_wool ) && !it.made_of( mat_cotton ) &&
+            !it.made_of( mat_nomex ) && !it.made_of( mat_leather ) &&
             ( has_trait( trait_HORNS_POINTED ) || has_trait( trait_ANTENNAE ) || has_trait( trait_ANTLERS ) ) ) {
             return ret_val<bool>::make_failure( _( "Cannot wear a helmet over %s." ),
                             ( has_trait( trait_HORNS_POINTED ) ? _( "horns" ) :
@@ -7179,7 +7209,7 @@ ret_val<bool> player::can_wield( const item &it ) const
     if( it.is_two_handed( *this ) && ( !has_two_arms() || worn_with_flag( "RESTRICT_HANDS" ) ) ) {
         if( worn_with_flag( "RESTRICT_HANDS" ) ) {
             return ret_val<bool>::make_failure( _( "Something you are wearing hinders the use of both hands." ) );
-        } else if( it.has_flag( "ALWAYS_TWOHAND" ) ) {
+        } else if( it.has_flag( flag_ALWAYS_TWOHAND ) ) {
             return ret_val<bool>::make_failure( _( "The %s can't be wielded with only one arm." ), it.tname().c_str() );
         } else {
             return ret_val<bool>::make_failure( _( "You are too weak to wield %s with only one arm." ), it.tname().c_str() );
@@ -7191,7 +7221,7 @@ ret_val<bool> player::can_wield( const item &it ) const
 
 ret_val<bool> player::can_unwield( const item& it ) const
 {
-    if( it.has_flag( "NO_UNWIELD" ) ) {
+    if( it.has_flag( flag_NO_UNWIELD ) ) {
         return ret_val<bool>::make_failure( _( "You cannot unwield your %s." ), it.tname().c_str() );
     }
 
@@ -7685,7 +7715,7 @@ int player::item_reload_cost( const item& it, const item& ammo, long qty ) const
     // We have the ammo in our hands right now
     int mv = item_handling_cost( obj, true, 0 );
 
-    if( ammo.has_flag( "MAG_BULKY" ) ) {
+    if( ammo.has_flag( flag_MAG_BULKY ) ) {
         mv *= 1.5; // bulky magazines take longer to insert
     }
 
@@ -7705,7 +7735,7 @@ int player::item_reload_cost( const item& it, const item& ammo, long qty ) const
     skill_id sk = it.is_gun() ? it.type->gun->skill_used : skill_gun;
     mv += cost / ( 1.0f + std::min( get_skill_level( sk ) * 0.1f, 1.0f ) );
 
-    if( it.has_flag( "STR_RELOAD" ) ) {
+    if( it.has_flag( flag_STR_RELOAD ) ) {
         /** @EFFECT_STR reduces reload time of some weapons */
         mv -= get_str() * 20;
     }
@@ -8054,7 +8084,7 @@ hint_rating player::rate_action_unload( const item &it ) const
         return HINT_GOOD;
     }
 
-    if( it.has_flag("NO_UNLOAD") ) {
+    if( it.has_flag(flag_NO_UNLOAD) ) {
         return HINT_CANT;
     }
 
@@ -8063,7 +8093,7 @@ hint_rating player::rate_action_unload( const item &it ) const
     }
 
     for( auto e : it.gunmods() ) {
-        if( e->is_gun() && !e->has_flag( "NO_UNLOAD" ) &&
+        if( e->is_gun() && !e->has_flag( flag_NO_UNLOAD ) &&
             ( e->magazine_current() || e->ammo_remaining() > 0 || e->casings_count() > 0 ) ) {
             return HINT_GOOD;
         }
@@ -8134,7 +8164,7 @@ bool player::has_enough_charges( const item &it, bool show_msg ) const
     if( !it.is_tool() || !it.ammo_required() ) {
         return true;
     }
-    if( it.has_flag( "USE_UPS" ) ) {
+    if( it.has_flag( flag_USE_UPS ) ) {
         if( has_charges( "UPS", it.ammo_required() ) || it.ammo_sufficient() ) {
             return true;
         }
@@ -8192,7 +8222,7 @@ bool player::consume_charges( item& used, long qty )
     }
 
     // USE_UPS never occurs on base items but is instead added by the UPS tool mod
-    if( used.has_flag( "USE_UPS" ) ) {
+    if( used.has_flag( flag_USE_UPS ) ) {
         // With the new UPS system, we'll want to use any charges built up in the tool before pulling from the UPS
         // The usage of the item was already approved, so drain item if possible, otherwise use UPS
         if( used.charges >= qty ) {
@@ -8370,7 +8400,7 @@ bool player::gunmod_remove( item &gun, item& mod )
 std::pair<int, int> player::gunmod_installation_odds( const item& gun, const item& mod ) const
 {
     // Mods with INSTALL_DIFFICULT have a chance to fail, potentially damaging the gun
-    if( !mod.has_flag( "INSTALL_DIFFICULT" ) || has_trait( trait_DEBUG_HS ) ) {
+    if( !mod.has_flag( flag_INSTALL_DIFFICULT ) || has_trait( trait_DEBUG_HS ) ) {
         return std::make_pair( 100, 0 );
     }
 
@@ -8635,7 +8665,7 @@ bool player::fun_to_read( const item &book ) const
     if( ( has_trait( trait_CANNIBAL ) || has_trait( trait_PSYCHOPATH ) || has_trait( trait_SAPIOVORE ) ) &&
         book.typeId() == "cookbook_human" ) {
         return true;
-    } else if( has_trait( trait_SPIRITUAL ) && book.has_flag( "INSPIRATIONAL" ) ) {
+    } else if( has_trait( trait_SPIRITUAL ) && book.has_flag( flag_INSPIRATIONAL ) ) {
         return true;
     } else {
         return book.type->book->fun > 0;
@@ -8891,7 +8921,7 @@ bool player::read( int inventory_position, const bool continuous )
               elem->has_trait( trait_SAPIOVORE ) ) &&
             it.typeId() == "cookbook_human" ) {
             elem->add_morale( MORALE_BOOK, 0, 75, decay_start + 3_minutes, decay_start, false, it.type );
-        } else if( elem->has_trait( trait_SPIRITUAL ) && it.has_flag( "INSPIRATIONAL" ) ) {
+        } else if( elem->has_trait( trait_SPIRITUAL ) && it.has_flag( flag_INSPIRATIONAL ) ) {
             elem->add_morale( MORALE_BOOK, 0, 90, decay_start + 6_minutes, decay_start, false, it.type );
         } else {
             elem->add_morale( MORALE_BOOK, 0, type->fun * 15, decay_start + 3_minutes, decay_start, false, it.type );
@@ -9000,7 +9030,7 @@ void player::do_read( item &book )
                 book.typeId() == "cookbook_human" ) {
                 fun_bonus = 25;
                 learner->add_morale( MORALE_BOOK, fun_bonus, fun_bonus * 3, 6_minutes, 3_minutes, true, book.type );
-            } else if( learner->has_trait( trait_SPIRITUAL ) && book.has_flag( "INSPIRATIONAL" ) ) {
+            } else if( learner->has_trait( trait_SPIRITUAL ) && book.has_flag( flag_INSPIRATIONAL ) ) {
                 fun_bonus = 15;
                 learner->add_morale( MORALE_BOOK, fun_bonus, fun_bonus * 5, 9_minutes, 9_minutes, true, book.type );
             } else {
@@ -9536,12 +9566,12 @@ int player::get_wind_resistance(body_part bp) const
 
     for( auto &i : worn ) {
         if( i.covers(bp) ) {
-            if( i.made_of( material_id( "leather" ) ) || i.made_of( material_id( "plastic" ) ) || i.made_of( material_id( "bone" ) ) ||
-                i.made_of( material_id( "chitin" ) ) || i.made_of( material_id( "nomex" ) ) ) {
+            if( i.made_of( mat_leather ) || i.made_of( mat_plastic ) || i.made_of( mat_bone ) ||
+                i.made_of( mat_chitin ) || i.made_of( mat_nomex ) ) {
                 penalty = 10; // 90% effective
-            } else if( i.made_of( material_id( "cotton" ) ) ) {
+            } else if( i.made_of( mat_cotton ) ) {
                 penalty = 30;
-            } else if( i.made_of( material_id( "wool" ) ) ) {
+            } else if( i.made_of( mat_wool ) ) {
                 penalty = 40;
             } else {
                 penalty = 1; // 99% effective
@@ -9572,7 +9602,7 @@ int player::warmth(body_part bp) const
             warmth = i.get_warmth();
             // Wool items do not lose their warmth due to being wet.
             // Warmth is reduced by 0 - 66% based on wetness.
-            if (!i.made_of( material_id( "wool" ) ))
+            if (!i.made_of( mat_wool ))
             {
                 warmth *= 1.0 - 0.66 * body_wetness[bp] / drench_capacity[bp];
             }
@@ -9778,7 +9808,7 @@ bool player::armor_absorb( damage_unit& du, item& armor )
     } else {
         // Sturdy items and power armors never take chip damage.
         // Other armors have 0.5% of getting damaged from hits below their armor value.
-        if( armor.has_flag("STURDY") || armor.is_power_armor() || !one_in( 200 ) ) {
+        if( armor.has_flag(flag_STURDY) || armor.is_power_armor() || !one_in( 200 ) ) {
             return false;
         }
     }
@@ -9801,7 +9831,7 @@ bool player::armor_absorb( damage_unit& du, item& armor )
                 m_neutral, damage_verb, m_info);
     }
 
-    return armor.mod_damage( armor.has_flag( "FRAGILE" ) ? rng( 2, 3 ) : 1, du.type );
+    return armor.mod_damage( armor.has_flag( flag_FRAGILE ) ? rng( 2, 3 ) : 1, du.type );
 }
 
 float player::bionic_armor_bonus( body_part bp, damage_type dt ) const
@@ -9993,7 +10023,7 @@ bool player::wearing_something_on(body_part bp) const
 bool player::natural_attack_restricted_on( body_part bp ) const
 {
     for( auto &i : worn ) {
-        if( i.covers( bp ) && !i.has_flag( "ALLOWS_NATURAL_ATTACKS" ) ) {
+        if( i.covers( bp ) && !i.has_flag( flag_ALLOWS_NATURAL_ATTACKS ) ) {
             return true;
         }
     }
@@ -10008,8 +10038,8 @@ bool player::is_wearing_shoes(std::string side) const
         left = false;
         for( const item &worn_item : worn ) {
             if (worn_item.covers(bp_foot_l) &&
-                !worn_item.has_flag("BELTED") &&
-                !worn_item.has_flag("SKINTIGHT")) {
+                !worn_item.has_flag(flag_BELTED) &&
+                !worn_item.has_flag(flag_SKINTIGHT)) {
                 left = true;
                 break;
             }
@@ -10019,8 +10049,8 @@ bool player::is_wearing_shoes(std::string side) const
         right = false;
         for( const item &worn_item : worn ) {
             if (worn_item.covers(bp_foot_r) &&
-                !worn_item.has_flag("BELTED") &&
-                !worn_item.has_flag("SKINTIGHT")) {
+                !worn_item.has_flag(flag_BELTED) &&
+                !worn_item.has_flag(flag_SKINTIGHT)) {
                 right = true;
                 break;
             }
@@ -10033,9 +10063,9 @@ bool player::is_wearing_helmet() const
 {
     for( auto i : worn ) {
         if( i.covers( bp_head ) &&
-            !i.has_flag( "HELMET_COMPAT" ) &&
-            !i.has_flag( "SKINTIGHT" ) &&
-            !i.has_flag( "OVERSIZE" ) ) {
+            !i.has_flag( flag_HELMET_COMPAT ) &&
+            !i.has_flag( flag_SKINTIGHT ) &&
+            !i.has_flag( flag_OVERSIZE ) ) {
             return true;
         }
     }
@@ -10047,8 +10077,8 @@ int player::head_cloth_encumbrance() const
     int ret = 0;
     for( auto &i : worn ) {
         const item *worn_item = &i;
-        if( i.covers( bp_head ) && ( worn_item->has_flag( "HELMET_COMPAT" ) ||
-                                     worn_item->has_flag( "SKINTIGHT" ) ) ) {
+        if( i.covers( bp_head ) && ( worn_item->has_flag( flag_HELMET_COMPAT ) ||
+                                     worn_item->has_flag( flag_SKINTIGHT ) ) ) {
             ret += worn_item->get_encumber();
         }
     }
@@ -10304,7 +10334,7 @@ bool player::has_gun_for_ammo( const ammotype &at ) const
 bool player::has_magazine_for_ammo( const ammotype &at ) const
 {
     return has_item_with( [&at]( const item & it ) {
-        return !it.has_flag( "NO_RELOAD" ) &&
+        return !it.has_flag( flag_NO_RELOAD ) &&
                ( ( it.is_magazine() && it.ammo_type() == at ) ||
                  ( it.is_gun() && it.magazine_integral() && it.ammo_type() == at ) ||
                  ( it.is_gun() && it.magazine_current() != nullptr &&
@@ -10319,11 +10349,11 @@ std::string player::weapname() const
         str << weapon.type_name();
 
         // Is either the base item or at least one auxiliary gunmod loaded (includes empty magazines)
-        bool base = weapon.ammo_capacity() > 0 && !weapon.has_flag( "RELOAD_AND_SHOOT" );
+        bool base = weapon.ammo_capacity() > 0 && !weapon.has_flag( flag_RELOAD_AND_SHOOT );
 
         const auto mods = weapon.gunmods();
         bool aux = std::any_of( mods.begin(), mods.end(), [&]( const item *e ) {
-            return e->is_gun() && e->ammo_capacity() > 0 && !e->has_flag( "RELOAD_AND_SHOOT" );
+            return e->is_gun() && e->ammo_capacity() > 0 && !e->has_flag( flag_RELOAD_AND_SHOOT );
         } );
 
         if( base || aux ) {
@@ -10339,7 +10369,7 @@ std::string player::weapname() const
             str << ")";
 
             for( auto e : mods ) {
-                if( e->is_gun() && e->ammo_capacity() > 0 && !e->has_flag( "RELOAD_AND_SHOOT" ) ) {
+                if( e->is_gun() && e->ammo_capacity() > 0 && !e->has_flag( flag_RELOAD_AND_SHOOT ) ) {
                     str << " (" << e->ammo_remaining();
                     if( e->magazine_integral() ) {
                         str << "/" << e->ammo_capacity();
@@ -10446,7 +10476,7 @@ nc_color encumb_color(int level)
 
 float player::get_melee() const
 {
-    return get_skill_level( skill_id( "melee" ) );
+    return get_skill_level( skill_melee );
 }
 
 void player::setID (int i)
@@ -11035,8 +11065,13 @@ std::vector<std::string> player::get_overlay_ids() const
 
 
     // first get effects
-    for( const auto &eff_pr : *effects ) {
-        rval.push_back( "effect_" + eff_pr.first.str() );
+    // effects of the same type are adjacent, list each type once
+    const effect *prev = nullptr;
+    for( const effect &eff : *effects ) {
+        if( prev == nullptr || prev->get_id() != eff.get_id() ) {
+            rval.push_back( "effect_" + eff.get_id().str() );
+        }
+        prev = &eff;
     }
 
     // then get mutations
@@ -219,12 +219,10 @@ void player::disp_info()
     std::vector<std::string> effect_text;
     std::string tmp = "";
     for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            tmp = _effect_it.second.disp_name();
-            if( !tmp.empty() ) {
-                effect_name.push_back( tmp );
-                effect_text.push_back( _effect_it.second.disp_desc() );
-            }
+        tmp = elem.disp_name();
+        if( !tmp.empty() ) {
+            effect_name.push_back( tmp );
+            effect_text.push_back( elem.disp_desc() );
         }
     }
     if( get_perceived_pain() > 0 ) {
@@ -618,15 +616,12 @@ Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4" ) );
 
     std::map<std::string, int> speed_effects;
     std::string dis_text = "";
-    for( auto &elem : *effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            bool reduced = resists_effect( it );
-            int move_adjust = it.get_mod( "SPEED", reduced );
-            if( move_adjust != 0 ) {
-                dis_text = it.get_speed_name();
-                speed_effects[dis_text] += move_adjust;
-            }
+    for( auto &it : *effects ) {
+        bool reduced = resists_effect( it );
+        int move_adjust = it.get_mod( "SPEED", reduced );
+        if( move_adjust != 0 ) {
+            dis_text = it.get_speed_name();
+            speed_effects[dis_text] += move_adjust;
         }
     }
 
@@ -1,25 +1,92 @@
 #include "rng.h"
 #include "output.h"
 #include "game_constants.h"
-#include <stdlib.h>
+#include <atomic>
 #include <random>
-#include <chrono>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
 
+static std::atomic<unsigned int> engine_seed( 0 );
+/** Number of threads whose default generator was seeded, to give each one its own seed. */
+static std::atomic<unsigned int> seeded_threads( 0 );
+
+rng_stream &rng_default_stream()
+{
+    static thread_local rng_stream stream( rng_split_seed( engine_seed, seeded_threads++ ) );
+    return stream;
+}
+
+void rng_set_engine_seed( const unsigned int seed )
+{
+    engine_seed = seed;
+    rng_default_stream().seed( seed );
+}
+
+/** Generator of the innermost @ref rng_seed_scope of this thread, if any. */
+static thread_local rng_stream *scoped_engine = nullptr;
+
+/** The generator the random functions draw from on this thread. */
+static rng_stream &current_stream()
+{
+    return scoped_engine != nullptr ? *scoped_engine : rng_default_stream();
+}
+
+void rng_stream::seed( const unsigned int seed )
+{
+    // The state must not be all zeros, which the mixing never gives for all four.
+    for( size_t i = 0; i < s.size(); i++ ) {
+        s[i] = rng_split_seed( seed, i );
+    }
+}
+
+rng_seed_scope::rng_seed_scope( const unsigned int seed ) : engine( seed ), previous( scoped_engine )
+{
+    scoped_engine = &engine;
+}
+
+rng_seed_scope::rng_seed_scope( rng_stream &stream ) : previous( scoped_engine )
+{
+    scoped_engine = &stream;
+}
+
+rng_seed_scope::~rng_seed_scope()
+{
+    scoped_engine = previous;
+}
+
+/** A random value in [0, 1), with the full 32 bits of the generator. */
+static double next_unit()
+{
+    return current_stream()() / 4294967296.0;
+}
+
+unsigned int rng_draw_seed()
+{
+    return current_stream()();
+}
+
+unsigned int rng_split_seed( const unsigned int seed, const unsigned int index )
+{
+    // splitmix32 style mixing, so neighbouring indices get unrelated seeds.
+    unsigned int z = seed + ( index + 1 ) * 0x9e3779b9u;
+    z = ( z ^ ( z >> 16 ) ) * 0x85ebca6bu;
+    z = ( z ^ ( z >> 13 ) ) * 0xc2b2ae35u;
+    return z ^ ( z >> 16 );
+}
+
 long rng( long val1, long val2 )
 {
     long minVal = ( val1 < val2 ) ? val1 : val2;
     long maxVal = ( val1 < val2 ) ? val2 : val1;
-    return minVal + long( ( maxVal - minVal + 1 ) * double( rand() / double( RAND_MAX + 1.0 ) ) );
+    return minVal + long( ( maxVal - minVal + 1 ) * next_unit() );
 }
 
 double rng_float( double val1, double val2 )
 {
     double minVal = ( val1 < val2 ) ? val1 : val2;
     double maxVal = ( val1 < val2 ) ? val2 : val1;
-    return minVal + ( maxVal - minVal ) * double( rand() ) / double( RAND_MAX + 1.0 );
+    return minVal + ( maxVal - minVal ) * next_unit();
 }
 
 bool one_in( int chance )
@@ -35,7 +102,7 @@ bool one_in_improved( double chance )
 
 bool x_in_y( double x, double y )
 {
-    return ( ( double )rand() / RAND_MAX ) <= ( ( double )x / y );
+    return ( current_stream()() / 4294967295.0 ) <= ( ( double )x / y );
 }
 
 int dice( int number, int sides )
@@ -94,7 +161,5 @@ double rng_normal( double lo, double hi )
 
 double normal_roll( double mean, double stddev )
 {
-    static std::default_random_engine eng(
-        std::chrono::system_clock::now().time_since_epoch().count() );
-    return std::normal_distribution<double>( mean, stddev )( eng );
+    return std::normal_distribution<double>( mean, stddev )( current_stream() );
 }
@@ -5,8 +5,11 @@
 #include "compatibility.h"
 #include "optional.h"
 
+#include <algorithm>
 #include <functional>
 #include <array>
+#include <cstdint>
+#include <random>
 
 long rng( long val1, long val2 );
 double rng_float( double val1, double val2 );
@@ -31,6 +34,98 @@ inline double rng_normal( double hi )
 
 double normal_roll( double mean, double stddev );
 
+/**
+ * A small and fast random number generator (xoshiro128**). It works with the distributions
+ * of <random>, and its whole state can be read and restored, e.g. to replay a sequence.
+ *
+ * The random functions above draw from the generator of the calling thread, see
+ * @ref rng_default_stream, or from the one of an active @ref rng_seed_scope.
+ */
+class rng_stream
+{
+    public:
+        using result_type = uint32_t;
+        using state_type = std::array<uint32_t, 4>;
+
+        explicit rng_stream( unsigned int seed = 0 ) {
+            this->seed( seed );
+        }
+        void seed( unsigned int seed );
+
+        static constexpr result_type min() {
+            return 0;
+        }
+        static constexpr result_type max() {
+            return UINT32_MAX;
+        }
+        result_type operator()() {
+            const uint32_t result = rotl( s[1] * 5, 7 ) * 9;
+            const uint32_t t = s[1] << 9;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = rotl( s[3], 11 );
+            return result;
+        }
+
+        const state_type &state() const {
+            return s;
+        }
+        void set_state( const state_type &state ) {
+            s = state;
+        }
+
+    private:
+        static uint32_t rotl( const uint32_t x, const int k ) {
+            return ( x << k ) | ( x >> ( 32 - k ) );
+        }
+
+        state_type s;
+};
+
+/**
+ * The generator the random functions use on the calling thread when there is no
+ * @ref rng_seed_scope. Each thread has its own one, the ones of other threads than the
+ * main one are seeded from the seed of the main one.
+ */
+rng_stream &rng_default_stream();
+/** Seeds the generator of the calling thread, and those of threads started later. */
+void rng_set_engine_seed( unsigned int seed );
+
+/**
+ * While an instance exists, the random functions above draw from a generator of its own,
+ * seeded with the given value, on the current thread instead of from the default one.
+ * Used where the result must only depend on the seed, not on what was generated before
+ * or at the same time on other threads (see overmap::generate).
+ * It can also be given a generator that outlives it, e.g. one that a subsystem keeps, so
+ * that it continues where the last scope with it left off.
+ * Instances can be nested, the previous generator is used again when the inner one is destroyed.
+ */
+class rng_seed_scope
+{
+    public:
+        explicit rng_seed_scope( unsigned int seed );
+        explicit rng_seed_scope( rng_stream &stream );
+        ~rng_seed_scope();
+
+        rng_seed_scope( const rng_seed_scope & ) = delete;
+        rng_seed_scope &operator=( const rng_seed_scope & ) = delete;
+
+    private:
+        rng_stream engine;
+        rng_stream *previous;
+};
+
+/** Draws a seed for a @ref rng_seed_scope from the current generator. */
+unsigned int rng_draw_seed();
+/**
+ * Derives the seed of the index-th of several independent generators from one seed, e.g.
+ * one per item of work that is done in parallel (see parallel_for_seeded).
+ */
+unsigned int rng_split_seed( unsigned int seed, unsigned int index );
+
 /**
  * Returns a random entry in the container.
  * The container must have a `size()` function and must support iterators as usual.
@@ -133,6 +228,18 @@ inline V random_entry_removed( C &container )
     return result;
 }
 
+/**
+ * Shuffles the range like std::random_shuffle, but draws from @ref rng, so the
+ * order follows an active @ref rng_seed_scope.
+ */
+template<typename Iterator>
+inline void rng_shuffle( Iterator first, Iterator last )
+{
+    std::random_shuffle( first, last, []( long n ) {
+        return rng( 0, n - 1 );
+    } );
+}
+
 namespace cata
 {
 template<typename T>
@@ -1117,11 +1117,11 @@ void overmap::save_monster_groups( JsonOut &jout ) const
     // Bin groups by their fields, except positions and monsters
     std::unordered_map<mongroup, std::list<tripoint>, mongroup_hash, mongroup_bin_eq> binned_groups;
     binned_groups.reserve( zg.size() );
-    for( const auto &pos_group : zg ) {
+    for( const mongroup &group : zg ) {
         // Each group in bin adds only position
         // so that 100 identical groups are 1 group data and 100 tripoints
-        std::list<tripoint> &positions = binned_groups[pos_group.second];
-        positions.emplace_back( pos_group.first );
+        std::list<tripoint> &positions = binned_groups[group];
+        positions.emplace_back( group.pos );
     }
 
     for( auto &group_bin : binned_groups ) {
@@ -2209,12 +2209,10 @@ void Creature::store( JsonOut &jsout ) const
 
     // Because JSON requires string keys we need to convert our int keys
     std::unordered_map<std::string, std::unordered_map<std::string, effect>> tmp_map;
-    for (auto maps : *effects) {
-        for (auto i : maps.second) {
-            std::ostringstream convert;
-            convert << i.first;
-            tmp_map[maps.first.str()][convert.str()] = i.second;
-        }
+    for( const effect &e : *effects ) {
+        std::ostringstream convert;
+        convert << e.get_bp();
+        tmp_map[e.get_id().str()][convert.str()] = e;
     }
     jsout.member( "effects", tmp_map );
 
@@ -2275,8 +2273,9 @@ void Creature::load( JsonObject &jsin )
                     }
                     const body_part bp = static_cast<body_part>( key_num );
                     effect &e = i.second;
+                    e.set_bp( bp );
 
-                    ( *effects )[id][bp] = e;
+                    effects->insert( e );
                     on_effect_int_change( id, e.get_intensity(), bp );
                 }
             }
@@ -204,7 +204,12 @@ void item::load_info( const std::string &data )
     for( int i = 0; i < tag_count; ++i )
     {
         dump >> item_tag;
-        if( !itag2ivar( item_tag, item_vars ) ) {
+        std::map<std::string, std::string> tag_vars;
+        if( itag2ivar( item_tag, tag_vars ) ) {
+            for( const auto &var : tag_vars ) {
+                set_var( var.first, var.second );
+            }
+        } else {
             item_tags.insert( item_tag );
         }
     }
@@ -2159,7 +2159,7 @@ void play_music(std::string playlist) {
         playlist_indexes.push_back( i );
     }
     if( list.shuffle ) {
-        std::random_shuffle( playlist_indexes.begin(), playlist_indexes.end() );
+        rng_shuffle( playlist_indexes.begin(), playlist_indexes.end() );
     }
 
     current_playlist = playlist;
@@ -107,69 +107,85 @@ void sounds::add_footstep( const tripoint &p, int volume, int, monster * )
         std::make_pair( p, sound_event {volume, "", false, true, "", ""} ) );
 }
 
-template <typename C>
-static void vector_quick_remove( std::vector<C> &source, int index )
-{
-    if( source.size() != 1 ) {
-        // Swap the target and the last element of the vector.
-        // This scrambles the vector, but makes removal O(1).
-        std::iter_swap( source.begin() + index, source.end() - 1 );
-    }
-    source.pop_back();
-}
-
-static std::vector<centroid> cluster_sounds( std::vector<std::pair<tripoint, int>> recent_sounds )
+/**
+ * Merges sounds in the same cell of the reality bubble into one centroid, in the order in
+ * which the first sound of each cluster was made. Cells start out as one submap on one
+ * z-level. If that gives more clusters than the old k-means made (10, or log of the number
+ * of sounds), the cells are doubled in each direction until it doesn't, so monsters and
+ * hordes never have to handle more than that.
+ * The result goes to sound_clusters, its storage and that of the cell lookup are reused
+ * from turn to turn.
+ */
+static void cluster_sounds( const std::vector<std::pair<tripoint, int>> &recent_sounds,
+                            std::vector<centroid> &sound_clusters )
 {
     // If there are too many monsters and too many noise sources (which can be monsters, go figure),
     // applying sound events to monsters can dominate processing time for the whole game,
     // so we cluster sounds and apply the centroids of the sounds to the monster AI
     // to fight the combinatorial explosion.
-    std::vector<centroid> sound_clusters;
-    const int num_seed_clusters = std::max( std::min( recent_sounds.size(), ( size_t ) 10 ),
-                                            ( size_t ) log( recent_sounds.size() ) );
-    const size_t stopping_point = recent_sounds.size() - num_seed_clusters;
-    const size_t max_map_distance = rl_dist( 0, 0, MAPSIZE * SEEX, MAPSIZE * SEEY );
-    // Randomly choose cluster seeds.
-    for( size_t i = recent_sounds.size(); i > stopping_point; i-- ) {
-        size_t index = rng( 0, i - 1 );
-        // The volume and cluster weight are the same for the first element.
-        sound_clusters.push_back(
-            // Assure the compiler that these int->float conversions are safe.
-        {
-            ( float ) recent_sounds[index].first.x, ( float ) recent_sounds[index].first.y,
-            ( float ) recent_sounds[index].first.z,
-            ( float ) recent_sounds[index].second, ( float ) recent_sounds[index].second
-        } );
-        vector_quick_remove( recent_sounds, index );
-    }
-    for( const auto &sound_event_pair : recent_sounds ) {
-        auto found_centroid = sound_clusters.begin();
-        float dist_factor = max_map_distance;
-        const auto cluster_end = sound_clusters.end();
-        for( auto centroid_iter = sound_clusters.begin(); centroid_iter != cluster_end;
-             ++centroid_iter ) {
-            // Scale the distance between the two by the max possible distance.
-            tripoint centroid_pos { ( int ) centroid_iter->x, ( int ) centroid_iter->y, ( int ) centroid_iter->z };
-            const int dist = rl_dist( sound_event_pair.first, centroid_pos );
-            if( dist * dist < dist_factor ) {
-                found_centroid = centroid_iter;
-                dist_factor = dist * dist;
+    const size_t max_clusters = std::max<size_t>( 10, std::log( recent_sounds.size() + 1 ) );
+    // Index of the cluster of each cell, -1 if there is none.
+    static std::vector<int> cell_clusters( MAPSIZE * MAPSIZE * OVERMAP_LAYERS, -1 );
+    static std::vector<size_t> cluster_cells;
+    // Used instead of the weighted average if all sounds of a cluster have no volume.
+    static std::vector<tripoint> first_sounds;
+
+    // Cell size in submaps (and z-levels), it always ends up with one cell for everything.
+    for( int scale = 1; ; scale *= 2 ) {
+        sound_clusters.clear();
+        cluster_cells.clear();
+        first_sounds.clear();
+        const int cells = ( MAPSIZE + scale - 1 ) / scale;
+        const auto cell_of = [scale]( const int local ) {
+            return std::max( 0, std::min( local / SEEX, MAPSIZE - 1 ) ) / scale;
+        };
+        bool too_many = false;
+        for( const auto &sound_event_pair : recent_sounds ) {
+            const tripoint &pos = sound_event_pair.first;
+            const int z = std::max( -OVERMAP_DEPTH, std::min( pos.z, OVERMAP_HEIGHT ) );
+            const size_t cell = ( ( ( z + OVERMAP_DEPTH ) / scale ) * cells + cell_of( pos.y ) ) * cells +
+                                cell_of( pos.x );
+            if( cell_clusters[cell] < 0 ) {
+                if( sound_clusters.size() == max_clusters && scale < MAPSIZE * OVERMAP_LAYERS ) {
+                    too_many = true;
+                    break;
+                }
+                cell_clusters[cell] = sound_clusters.size();
+                cluster_cells.push_back( cell );
+                first_sounds.push_back( pos );
+                sound_clusters.push_back( { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f } );
             }
+            centroid &found_centroid = sound_clusters[cell_clusters[cell]];
+            // Sum up the locations weighted by volume, they are divided by the total below.
+            const float volume = sound_event_pair.second;
+            found_centroid.x += pos.x * volume;
+            found_centroid.y += pos.y * volume;
+            found_centroid.z += pos.z * volume;
+            // Set the centroid volume to the larger of the volumes.
+            found_centroid.volume = std::max( found_centroid.volume, volume );
+            // Set the centroid weight to the sum of the weights.
+            found_centroid.weight += volume;
+        }
+        for( const size_t cell : cluster_cells ) {
+            cell_clusters[cell] = -1;
+        }
+        if( !too_many ) {
+            break;
+        }
+    }
+
+    for( size_t i = 0; i < sound_clusters.size(); i++ ) {
+        centroid &this_centroid = sound_clusters[i];
+        if( this_centroid.weight > 0.0f ) {
+            this_centroid.x /= this_centroid.weight;
+            this_centroid.y /= this_centroid.weight;
+            this_centroid.z /= this_centroid.weight;
+        } else {
+            this_centroid.x = first_sounds[i].x;
+            this_centroid.y = first_sounds[i].y;
+            this_centroid.z = first_sounds[i].z;
         }
-        const float volume_sum = ( float ) sound_event_pair.second + found_centroid->weight;
-        // Set the centroid location to the average of the two locations, weighted by volume.
-        found_centroid->x = ( float )( ( sound_event_pair.first.x * sound_event_pair.second ) +
-                                       ( found_centroid->x * found_centroid->weight ) ) / volume_sum;
-        found_centroid->y = ( float )( ( sound_event_pair.first.y * sound_event_pair.second ) +
-                                       ( found_centroid->y * found_centroid->weight ) ) / volume_sum;
-        found_centroid->z = ( float )( ( sound_event_pair.first.z * sound_event_pair.second ) +
-                                       ( found_centroid->z * found_centroid->weight ) ) / volume_sum;
-        // Set the centroid volume to the larger of the volumes.
-        found_centroid->volume = std::max( found_centroid->volume, ( float ) sound_event_pair.second );
-        // Set the centroid weight to the sum of the weights.
-        found_centroid->weight = volume_sum;
     }
-    return sound_clusters;
 }
 
 int get_signal_for_hordes( const centroid &centr )
@@ -199,8 +215,31 @@ int get_signal_for_hordes( const centroid &centr )
 
 void sounds::process_sounds()
 {
-    std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
+    static std::vector<centroid> sound_clusters;
+    cluster_sounds( recent_sounds, sound_clusters );
     const int weather_vol = weather_data( g->weather ).sound_attn;
+
+    // The monsters, sorted into the submaps of the reality bubble (ignoring z-levels),
+    // so each sound only has to look at the ones in the submaps it can reach.
+    // The buckets hold indices into monsters, so they are visited in the usual order.
+    static std::vector<monster *> monsters;
+    static std::vector<std::vector<size_t>> monsters_by_submap( MAPSIZE * MAPSIZE );
+    monsters.clear();
+    for( std::vector<size_t> &bucket : monsters_by_submap ) {
+        bucket.clear();
+    }
+    const auto submap_of = []( const int local ) {
+        return std::max( 0, std::min( local / SEEX, MAPSIZE - 1 ) );
+    };
+    if( !sound_clusters.empty() ) {
+        for( monster &critter : g->all_monsters() ) {
+            const size_t bucket = submap_of( critter.posx() ) * MAPSIZE + submap_of( critter.posy() );
+            monsters_by_submap[bucket].push_back( monsters.size() );
+            monsters.push_back( &critter );
+        }
+    }
+    static std::vector<size_t> nearby;
+
     for( const auto &this_centroid : sound_clusters ) {
         // Since monsters don't go deaf ATM we can just use the weather modified volume
         // If they later get physical effects from loud noises we'll have to change this
@@ -218,7 +257,23 @@ void sounds::process_sounds()
             overmap_buffer.signal_hordes( target, sig_power );
         }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // Those further away than vol * 2 can't hear it, skip the submaps they are in.
+        if( vol <= 0 ) {
+            continue;
+        }
+        nearby.clear();
+        const int max_dist = vol * 2 - 1;
+        const int max_smx = submap_of( source.x + max_dist );
+        const int max_smy = submap_of( source.y + max_dist );
+        for( int smx = submap_of( source.x - max_dist ); smx <= max_smx; smx++ ) {
+            for( int smy = submap_of( source.y - max_dist ); smy <= max_smy; smy++ ) {
+                const std::vector<size_t> &bucket = monsters_by_submap[smx * MAPSIZE + smy];
+                nearby.insert( nearby.end(), bucket.begin(), bucket.end() );
+            }
+        }
+        std::sort( nearby.begin(), nearby.end() );
+        for( const size_t index : nearby ) {
+            monster &critter = *monsters[index];
             // @todo: Generalize this to Creature::hear_sound
             const int dist = rl_dist( source, critter.pos() );
             if( vol * 2 > dist ) {
@@ -413,7 +468,8 @@ std::vector<tripoint> sounds::get_footstep_markers()
 
 std::pair<std::vector<tripoint>, std::vector<tripoint>> sounds::get_monster_sounds()
 {
-    auto sound_clusters = cluster_sounds( recent_sounds );
+    std::vector<centroid> sound_clusters;
+    cluster_sounds( recent_sounds, sound_clusters );
     std::vector<tripoint> sound_locations;
     sound_locations.reserve( recent_sounds.size() );
     for( const auto &sound : recent_sounds ) {
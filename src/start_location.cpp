@@ -15,6 +15,7 @@
 #include "overmap.h"
 #include "overmapbuffer.h"
 #include "player.h"
+#include "rng.h"
 
 #include <algorithm>
 
@@ -379,7 +380,7 @@ void start_location::burn( const tripoint &omtstart,
             }
         }
     }
-    random_shuffle( valid.begin(), valid.end() );
+    rng_shuffle( valid.begin(), valid.end() );
     for( size_t i = 0; i < std::min( count, valid.size() ); i++ ) {
         m.add_field( valid[i], fd_fire, 3 );
     }
@@ -0,0 +1,69 @@
+#include "string_id.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+
+struct string_table {
+    std::mutex mutex;
+    // deque never moves its elements, the ids point into it
+    std::deque<string_id_detail::interned_string> strings;
+    std::unordered_map<std::string, const string_id_detail::interned_string *> index;
+
+    string_table() {
+        strings.push_back( string_id_detail::interned_string{ std::string(), 0 } );
+        index.emplace( std::string(), &strings.back() );
+    }
+};
+
+// Function local so ids with static storage can be constructed safely.
+string_table &get_string_table()
+{
+    static string_table table;
+    return table;
+}
+
+} // namespace
+
+namespace string_id_detail
+{
+
+const interned_string *intern( const std::string &str )
+{
+    if( str.empty() ) {
+        return empty_string();
+    }
+    // Strings are never removed from the table, so each thread can remember what it has
+    // looked up before and only needs the lock for strings it hasn't seen yet.
+    static thread_local std::unordered_map<std::string, const interned_string *> seen;
+    const auto cached = seen.find( str );
+    if( cached != seen.end() ) {
+        return cached->second;
+    }
+    const interned_string *result = nullptr;
+    {
+        string_table &table = get_string_table();
+        std::lock_guard<std::mutex> lock( table.mutex );
+        const auto iter = table.index.find( str );
+        if( iter != table.index.end() ) {
+            result = iter->second;
+        } else {
+            table.strings.push_back( interned_string{ str, table.strings.size() } );
+            result = &table.strings.back();
+            table.index.emplace( str, result );
+        }
+    }
+    seen.emplace( str, result );
+    return result;
+}
+
+const interned_string *empty_string()
+{
+    static const interned_string *empty = &get_string_table().strings.front();
+    return empty;
+}
+
+} // namespace string_id_detail
@@ -2,12 +2,31 @@
 #ifndef STRING_ID_H
 #define STRING_ID_H
 
+#include <atomic>
 #include <string>
 #include <type_traits>
 
 template<typename T>
 class int_id;
 
+namespace string_id_detail
+{
+/**
+ * Entry of the process wide table of id strings. Each distinct string is stored once,
+ * entries are never moved or released.
+ */
+struct interned_string {
+    std::string str;
+    /** Assigned in order of interning, used as hash value. */
+    size_t index;
+};
+
+/** Returns the table entry for the string, adding it if needed. Thread safe. */
+const interned_string *intern( const std::string &str );
+/** The entry of the empty string, which is always in the table. */
+const interned_string *empty_string();
+} // namespace string_id_detail
+
 /**
  * This represents an identifier (implemented as std::string) of some object.
  * It can be used for all type of objects, one just needs to specify a type as
@@ -35,6 +54,9 @@ class int_id;
  * Note that for this to work, the template parameter type does note even need to be
  * known when the string_id is used. In fact, it does not even need to be defined at all,
  * a declaration is just enough.
+ *
+ * The id strings are interned (see @ref string_id_detail::intern) when the id is
+ * constructed, so copying, equality comparison and hashing are pointer/integer operations.
  */
 template<typename T>
 class string_id
@@ -51,29 +73,38 @@ class string_id
         // a std::string, otherwise a "no matching function to call..." error is generated.
         template<typename S, class = typename
                  std::enable_if< std::is_convertible<S, std::string >::value>::type >
-        explicit string_id( S && id, int cid = -1 ) : _id( std::forward<S>( id ) ), _cid( cid ) {
+        explicit string_id( S && id, int cid = -1 ) :
+            _id( string_id_detail::intern( std::string( std::forward<S>( id ) ) ) ), _cid( cid ) {
         }
         /**
          * Default constructor constructs an empty id string.
          * Note that this id class does not enforce empty id strings (or any specific string at all)
          * to be special. Every string (including the empty one) may be a valid id.
          */
-        string_id() : _id(), _cid( -1 ) {}
+        string_id() : _id( string_id_detail::empty_string() ), _cid( -1 ) {}
+        string_id( const This &rhs ) : _id( rhs._id ),
+            _cid( rhs._cid.load( std::memory_order_relaxed ) ) {}
+        This &operator=( const This &rhs ) {
+            _id = rhs._id;
+            _cid.store( rhs._cid.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+            return *this;
+        }
         /**
          * Comparison, only useful when the id is used in std::map or std::set as key. Compares
-         * the string id as with the strings comparison.
+         * the string id as with the strings comparison, so ordered containers keep their
+         * (alphabetical) order.
          */
         bool operator<( const This &rhs ) const {
-            return _id < rhs._id;
+            return _id != rhs._id && _id->str < rhs._id->str;
         }
         /**
-         * The usual comparator, compares the string id as usual.
+         * The usual comparator, equal strings are interned to the same entry.
          */
         bool operator==( const This &rhs ) const {
             return _id == rhs._id;
         }
         /**
-         * The usual comparator, compares the string id as usual.
+         * The usual comparator, equal strings are interned to the same entry.
          */
         bool operator!=( const This &rhs ) const {
             return _id != rhs._id;
@@ -82,7 +113,7 @@ class string_id
          * The unusual comparator, compares the string id to char *
          */
         bool operator==( const char *rhs ) const {
-            return _id == rhs;
+            return _id->str == rhs;
         }
         /**
          * Interface to the plain C-string of the id. This function mimics the std::string
@@ -90,7 +121,7 @@ class string_id
          * to be included in the format string, e.g. debugmsg("invalid id: %s", id.c_str())
          */
         const char *c_str() const {
-            return _id.c_str();
+            return _id->str.c_str();
         }
         /**
          * Returns the identifier as plain std::string. Use with care, the plain string does not
@@ -98,11 +129,16 @@ class string_id
          * the class).
          */
         const std::string &str() const {
-            return _id;
+            return _id->str;
         }
 
         explicit operator std::string() const {
-            return _id;
+            return _id->str;
+        }
+
+        /** Unique index of the id string, the same for all ids with the same string. */
+        size_t symbol() const {
+            return _id->index;
         }
 
         // Those are optional, you need to implement them on your own if you want to use them.
@@ -135,7 +171,7 @@ class string_id
          * keep consistency with the rest is_.. functions
          */
         bool is_empty() const {
-            return _id.empty();
+            return _id == string_id_detail::empty_string();
         }
         /**
          * Returns a null id whose `string_id<T>::is_null()` must always return true. See @ref is_null.
@@ -179,27 +215,31 @@ class string_id
          * Assigns a new value for the cached int id.
          */
         void set_cid( const int_id<T> &cid ) const {
-            _cid = cid.to_i();
+            _cid.store( cid.to_i(), std::memory_order_relaxed );
         }
         /**
          * Returns the current value of cached id
          */
         int_id<T> get_cid() const {
-            return int_id<T>( _cid );
+            return int_id<T>( _cid.load( std::memory_order_relaxed ) );
         }
 
     private:
-        std::string _id;
-        mutable int _cid;
+        const string_id_detail::interned_string *_id;
+        /**
+         * Cached int id, may be stale (the factory checks it). Atomic because ids with
+         * static storage are looked up from worker threads, e.g. in overmap generation.
+         */
+        mutable std::atomic<int> _cid;
 };
 
-// Support hashing of string based ids by forwarding the hash of the string.
+// Support hashing of string based ids by using the index of the interned string.
 namespace std
 {
 template<typename T>
 struct hash< string_id<T> > {
     std::size_t operator()( const string_id<T> &v ) const {
-        return hash<std::string>()( v.str() );
+        return v.symbol();
     }
 };
 }
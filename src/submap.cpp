@@ -32,6 +32,21 @@ void submap::delete_vehicles()
     vehicles.clear();
 }
 
+const submap_item_summary &submap::get_item_summary() const
+{
+    if( !item_summary_dirty ) {
+        return item_summary;
+    }
+    item_summary = submap_item_summary();
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            item_summary.count += itm[x][y].size();
+        }
+    }
+    item_summary_dirty = false;
+    return item_summary;
+}
+
 static const std::string COSMETICS_GRAFFITI( "GRAFFITI" );
 
 bool submap::has_graffiti( int x, int y ) const
@@ -46,6 +46,17 @@ struct spawn_point {
         mission_id( MIS ), friendly( F ), name( N ) {}
 };
 
+/**
+ * What lies on a submap, see @ref submap::get_item_summary.
+ * Only the number of items: the searches that look at it (npc::find_item) rate each item
+ * by its tname, weapon value, nutrition and so on, which counts by type or category or a
+ * price bound can't answer for them.
+ */
+struct submap_item_summary {
+    /** Number of items, their contents are not counted. */
+    int count = 0;
+};
+
 struct submap {
     trap_id get_trap( const int x, const int y ) const {
         return trp[x][y];
@@ -113,6 +124,19 @@ struct submap {
         }
     }
 
+    /**
+     * What lies on this submap. It's worked out again on the first call after items
+     * were added or removed, see @ref invalidate_item_summary.
+     */
+    const submap_item_summary &get_item_summary() const;
+    /**
+     * Must be called after items were added to or removed from @ref itm, or were
+     * changed into other items.
+     */
+    void invalidate_item_summary() {
+        item_summary_dirty = true;
+    }
+
     bool has_graffiti( int x, int y ) const;
     const std::string &get_graffiti( int x, int y ) const;
     void set_graffiti( int x, int y, const std::string &new_graffiti );
@@ -181,6 +205,9 @@ struct submap {
     std::unique_ptr<computer> comp;
     basecamp camp;  // only allowing one basecamp per submap
 
+    mutable submap_item_summary item_summary;
+    mutable bool item_summary_dirty = true;
+
     submap();
     ~submap();
     // delete vehicles and clear the vehicles vector
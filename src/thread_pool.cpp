@@ -0,0 +1,287 @@
+#include "thread_pool.h"
+
+#include "options.h"
+#include "rng.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if ((defined _WIN32 || defined WINDOWS) && !defined _MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+static const option_handle<int> option_worker_threads( "WORKER_THREADS" );
+
+// Set on the worker threads, work handed out from them runs right there.
+static thread_local bool is_worker_thread = false;
+
+namespace
+{
+
+/** The worker threads and the queue of tasks they take from. */
+class thread_pool
+{
+    public:
+        ~thread_pool() {
+            std::lock_guard<std::mutex> lock( threads_mutex );
+            stop();
+        }
+
+        /**
+         * Starts or stops workers to match the option. The old workers finish the queued
+         * tasks before they stop, even the tickets of tasks whose waiter already ran them.
+         */
+        size_t workers() {
+            const int option_value = option_worker_threads.value();
+            const size_t wanted = option_value > 0 ? option_value - 1 :
+                                  std::max( 1u, std::thread::hardware_concurrency() ) - 1;
+            std::lock_guard<std::mutex> threads_lock( threads_mutex );
+            if( wanted != threads.size() ) {
+                stop();
+                start( wanted );
+            }
+            return threads.size();
+        }
+
+        void submit( std::function<void()> task ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                queue.push_back( std::move( task ) );
+            }
+            wake.notify_one();
+        }
+
+        /**
+         * Queues a task that only runs when there is nothing in the main queue. Nobody ever
+         * helps with these, so blocking work like file reads never delays the caller of
+         * @ref parallel_for or the tasks queued after it.
+         */
+        void submit_background( std::function<void()> task ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                background.push_back( std::move( task ) );
+            }
+            wake.notify_one();
+        }
+
+    private:
+        // Only called with threads_mutex held. stop can't hold mutex as well, the
+        // workers it joins need it to finish.
+        void start( const size_t count ) {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = false;
+            }
+            for( size_t i = 0; i < count; i++ ) {
+                threads.emplace_back( [this]() {
+                    is_worker_thread = true;
+                    work();
+                } );
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = true;
+            }
+            wake.notify_all();
+            for( std::thread &t : threads ) {
+                t.join();
+            }
+            threads.clear();
+        }
+
+        void work() {
+            while( true ) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock( mutex );
+                    wake.wait( lock, [this]() {
+                        return stopping || !queue.empty() || !background.empty();
+                    } );
+                    std::deque<std::function<void()>> &from = !queue.empty() ? queue : background;
+                    if( from.empty() ) {
+                        return;
+                    }
+                    task = std::move( from.front() );
+                    from.pop_front();
+                }
+                task();
+            }
+        }
+
+        /** Guarded by threads_mutex, starting and stopping workers is done under it. */
+        std::vector<std::thread> threads;
+        std::mutex threads_mutex;
+        /** Guards the queues and the flag below. */
+        std::mutex mutex;
+        std::deque<std::function<void()>> queue;
+        std::deque<std::function<void()>> background;
+        std::condition_variable wake;
+        bool stopping = false;
+};
+
+thread_pool &get_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+/**
+ * Tasks handed out together, queued here and not in the pool. The pool only gets a ticket
+ * per task that runs the next one of these, so whoever waits for them can run the ones no
+ * worker has taken yet itself, without running anything unrelated.
+ */
+struct pending_counter {
+    std::mutex mutex;
+    std::condition_variable done;
+    std::deque<std::function<void()>> tasks;
+    /** Tasks that are queued or running. */
+    int count = 0;
+
+    static void submit( const std::shared_ptr<pending_counter> &group, std::function<void()> task ) {
+        {
+            std::lock_guard<std::mutex> lock( group->mutex );
+            group->tasks.push_back( std::move( task ) );
+            group->count++;
+        }
+        get_pool().submit( [group]() {
+            group->run_one();
+        } );
+    }
+
+    /** Runs one of the queued tasks, returns false if there was none left. */
+    bool run_one() {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            if( tasks.empty() ) {
+                return false;
+            }
+            task = std::move( tasks.front() );
+            tasks.pop_front();
+        }
+        task();
+        std::lock_guard<std::mutex> lock( mutex );
+        if( --count == 0 ) {
+            done.notify_all();
+        }
+        return true;
+    }
+
+    /**
+     * Runs the tasks no worker has started yet, so this makes progress even when all
+     * workers are busy, then waits for the ones other threads are running.
+     */
+    void wait() {
+        while( run_one() ) {
+        }
+        std::unique_lock<std::mutex> lock( mutex );
+        done.wait( lock, [this]() {
+            return count == 0;
+        } );
+    }
+};
+
+} // namespace
+
+struct task_group::state : pending_counter {
+};
+
+void parallel_for( const int begin, const int end, const std::function<void( int )> &body,
+                   const int grain )
+{
+    const int count = end - begin;
+    if( count <= 0 ) {
+        return;
+    }
+    const size_t workers = is_worker_thread ? 0 : get_pool().workers();
+    const int chunk = std::max( grain, 1 );
+    const int chunks = ( count + chunk - 1 ) / chunk;
+    if( workers == 0 || chunks == 1 ) {
+        for( int i = begin; i < end; i++ ) {
+            body( i );
+        }
+        return;
+    }
+
+    std::atomic<int> next( begin );
+    const auto run_chunks = [&]() {
+        while( true ) {
+            const int first = next.fetch_add( chunk );
+            if( first >= end ) {
+                return;
+            }
+            const int last = std::min( first + chunk, end );
+            for( int i = first; i < last; i++ ) {
+                body( i );
+            }
+        }
+    };
+    // The helpers only refer to data on this stack frame, which is fine because this
+    // doesn't return before all of them are done or were run here. The tickets left in the
+    // pool only keep the (then empty) group alive.
+    const auto helpers = std::make_shared<pending_counter>();
+    const size_t helper_count = std::min<size_t>( workers, chunks - 1 );
+    for( size_t i = 0; i < helper_count; i++ ) {
+        pending_counter::submit( helpers, [&run_chunks]() {
+            run_chunks();
+        } );
+    }
+    run_chunks();
+    helpers->wait();
+}
+
+void parallel_for_seeded( const int begin, const int end, const std::function<void( int )> &body,
+                          const int grain )
+{
+    const unsigned int seed = rng_draw_seed();
+    parallel_for( begin, end, [seed, &body]( const int i ) {
+        const rng_seed_scope seeded_rng( rng_split_seed( seed, i ) );
+        body( i );
+    }, grain );
+}
+
+int parallel_thread_count()
+{
+    return ( is_worker_thread ? 0 : get_pool().workers() ) + 1;
+}
+
+void run_in_background( std::function<void()> task )
+{
+    if( is_worker_thread || get_pool().workers() == 0 ) {
+        task();
+        return;
+    }
+    get_pool().submit_background( std::move( task ) );
+}
+
+task_group::task_group() : pending( std::make_shared<state>() )
+{
+}
+
+task_group::~task_group()
+{
+    wait();
+}
+
+void task_group::run( std::function<void()> task )
+{
+    if( is_worker_thread || get_pool().workers() == 0 ) {
+        task();
+        return;
+    }
+    pending_counter::submit( pending, std::move( task ) );
+}
+
+void task_group::wait()
+{
+    pending->wait();
+}
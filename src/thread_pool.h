@@ -0,0 +1,70 @@
+#pragma once
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <functional>
+#include <memory>
+
+/**
+ * Worker threads shared by the whole engine. They are started the first time work is
+ * handed to them, their number follows the "WORKER_THREADS" option.
+ *
+ * The functions below run work on the workers and on the calling thread and only return
+ * once all of it is done. Called from a worker (nested parallelism), or when there are
+ * no workers, they simply run everything on the calling thread.
+ *
+ * Work that runs in parallel must only read shared game state and only write to data
+ * that no other part of the same work writes to. It must not call debugmsg, add messages
+ * or use the global random generator, see @ref parallel_for_seeded for the latter.
+ */
+
+/**
+ * Calls `body( i )` for each i in [begin, end), in parallel and in no particular order.
+ * Indices are handed out in chunks of about `grain` indices, idle threads take the next one.
+ */
+void parallel_for( int begin, int end, const std::function<void( int )> &body, int grain = 1 );
+
+/**
+ * Like @ref parallel_for, but `body( i )` runs with the random functions of rng.h drawing
+ * from a generator of its own, seeded with a seed drawn once from the current generator
+ * and the index. The results depend only on that seed, not on how the work was split.
+ */
+void parallel_for_seeded( int begin, int end, const std::function<void( int )> &body,
+                          int grain = 1 );
+
+/** Number of threads that @ref parallel_for uses, including the calling thread. */
+int parallel_thread_count();
+
+/**
+ * Queues the task for the workers and returns right away, or runs it right away when
+ * there are no workers (or when called from a worker). Nothing waits for it, the caller
+ * keeps track of it, e.g. with a std::packaged_task. Used for reads the main thread
+ * should not wait for, see mapbuffer::prefetch_quad. Such tasks have their own queue,
+ * workers only take from it when no parallel work is queued, and the threads waiting
+ * for parallel work never run them.
+ */
+void run_in_background( std::function<void()> task );
+
+/**
+ * A set of tasks that run in parallel, @ref wait returns when all of them are done.
+ * The destructor waits as well.
+ */
+class task_group
+{
+    public:
+        task_group();
+        ~task_group();
+
+        task_group( const task_group & ) = delete;
+        task_group &operator=( const task_group & ) = delete;
+
+        void run( std::function<void()> task );
+        void wait();
+
+        struct state;
+
+    private:
+        std::shared_ptr<state> pending;
+};
+
+#endif
@@ -1793,7 +1793,7 @@ void veh_interact::display_stats()
     const int extraw = ((TERMX - FULL_SCREEN_WIDTH) / 4) * 2; // see exec()
     int x[18], y[18], w[18]; // 3 columns * 6 rows = 18 slots max
 
-    std::vector<int> cargo_parts = veh->all_parts_with_feature("CARGO");
+    std::vector<int> cargo_parts = veh->all_parts_with_feature( VPFLAG_CARGO );
     units::volume total_cargo = 0;
     units::volume free_cargo = 0;
     for( const auto &p : cargo_parts ) {
@@ -129,6 +129,7 @@ vehicle::~vehicle() = default;
 
 void vehicle::set_hp( vehicle_part &pt, int qty )
 {
+    invalidate_physics();
     if( qty == pt.info().durability ) {
         pt.base.set_damage( 0 );
 
@@ -143,6 +144,7 @@ void vehicle::set_hp( vehicle_part &pt, int qty )
 
 bool vehicle::mod_hp( vehicle_part &pt, int qty, damage_type dt )
 {
+    invalidate_physics();
     double k = pt.base.max_damage() / double( pt.info().durability );
     return pt.base.mod_damage( - qty * k, dt );
 }
@@ -335,7 +337,7 @@ void vehicle::init_state(int init_veh_fuel, int init_veh_status)
     //Provide some variety to non-mint vehicles
     if( veh_status != 0 ) {
         //Leave engine running in some vehicles, if the engine has not been destroyed
-        if( veh_fuel_mult > 0 && all_parts_with_feature("ENGINE", true).size() > 0 &&
+        if( veh_fuel_mult > 0 && all_parts_with_feature( VPFLAG_ENGINE, true ).size() > 0 &&
             one_in(8) && !destroyEngine && !has_no_key && has_engine_type_not(fuel_type_muscle, true) ) {
             engine_on = true;
         }
@@ -2234,6 +2236,21 @@ void get_parts_helper( Vehicle &veh, const Flag &flag, Vector &ret, bool enabled
     }
 }
 
+// Bitflags are indexed, so only the parts having the flag are visited
+template<typename Vehicle, typename Vector>
+void get_parts_helper( Vehicle &veh, const vpart_bitflags &flag, Vector &ret, bool enabled )
+{
+    if( veh.parts_by_flag.empty() ) {
+        return;
+    }
+    for( const int p : veh.parts_by_flag[flag] ) {
+        auto &e = veh.parts[p];
+        if( ( !enabled || e.enabled ) && !e.is_broken() ) {
+            ret.emplace_back( &e );
+        }
+    }
+}
+
 std::vector<vehicle_part *> vehicle::get_parts( const std::string &flag, bool enabled )
 {
     std::vector<vehicle_part *> res;
@@ -2409,11 +2426,17 @@ std::vector<int> vehicle::all_parts_with_feature(const std::string& feature, boo
 
 std::vector<int> vehicle::all_parts_with_feature(vpart_bitflags feature, bool const unbroken) const
 {
+    if( parts_by_flag.empty() ) {
+        return std::vector<int>();
+    }
+    const std::vector<int> &with_flag = parts_by_flag[feature];
+    if( !unbroken ) {
+        return with_flag;
+    }
     std::vector<int> parts_found;
-    for( size_t part_index = 0; part_index < parts.size(); ++part_index ) {
-        if(part_info(part_index).has_flag(feature) &&
-                ( !unbroken || !parts[ part_index ].is_broken() ) ) {
-            parts_found.push_back(part_index);
+    for( const int part_index : with_flag ) {
+        if( !parts[ part_index ].is_broken() ) {
+            parts_found.push_back( part_index );
         }
     }
     return parts_found;
@@ -3282,13 +3305,11 @@ void vehicle::noise_and_smoke( double load, double time )
 
 float vehicle::wheel_area( bool boat ) const
 {
-    float total_area = 0.0f;
-    const auto &wheel_indices = boat ? floating : wheelcache;
-    for( auto &wheel_index : wheel_indices ) {
-        total_area += parts[ wheel_index ].base.wheel_area();
+    if( physics_dirty ) {
+        refresh_physics();
     }
 
-    return total_area;
+    return boat ? boat_wheel_area_cache : wheel_area_cache;
 }
 
 float vehicle::k_friction() const
@@ -3300,35 +3321,11 @@ float vehicle::k_friction() const
 
 float vehicle::k_aerodynamics() const
 {
-    const int max_obst = 13;
-    int obst[max_obst];
-    for( auto &elem : obst ) {
-        elem = 0;
+    if( physics_dirty ) {
+        refresh_physics();
     }
-    std::vector<int> structure_indices = all_parts_at_location(part_location_structure);
-    for( auto &structure_indice : structure_indices ) {
-        int p = structure_indice;
-        int frame_size = part_with_feature(p, VPFLAG_OBSTACLE) ? 30 : 10;
-        int pos = parts[p].mount.y + max_obst / 2;
-        if (pos < 0) {
-            pos = 0;
-        }
-        if (pos >= max_obst) {
-            pos = max_obst -1;
-        }
-        if (obst[pos] < frame_size) {
-            obst[pos] = frame_size;
-        }
-    }
-    int frame_obst = 0;
-    for( auto &elem : obst ) {
-        frame_obst += elem;
-    }
-    float ae0 = 200.0;
 
-    // calculate aerodynamic coefficient
-    float ka = ( ae0 / (ae0 + frame_obst) );
-    return ka;
+    return k_aerodynamics_cache;
 }
 
 float vehicle::k_dynamics() const
@@ -5128,17 +5125,13 @@ void vehicle::gain_moves()
  */
 void vehicle::refresh()
 {
-    alternators.clear();
-    engines.clear();
     reactors.clear();
-    solar_panels.clear();
     funnels.clear();
     relative_parts.clear();
     loose_parts.clear();
-    wheelcache.clear();
     steering.clear();
     speciality.clear();
-    floating.clear();
+    parts_by_flag.assign( NUM_VPFLAGS, std::vector<int>() );
     tracking_epower = 0;
     alternator_load = 0;
     camera_epower = 0;
@@ -5158,27 +5151,20 @@ void vehicle::refresh()
         if( parts[p].removed ) {
             continue;
         }
-        if( vpi.has_flag(VPFLAG_ALTERNATOR) ) {
-            alternators.push_back( p );
-        }
-        if( vpi.has_flag(VPFLAG_ENGINE) ) {
-            engines.push_back( p );
+        for( int f = 0; f < NUM_VPFLAGS; f++ ) {
+            if( vpi.has_flag( static_cast<vpart_bitflags>( f ) ) ) {
+                parts_by_flag[f].push_back( p );
+            }
         }
         if( vpi.has_flag("REACTOR") ) {
             reactors.push_back( p );
         }
-        if( vpi.has_flag(VPFLAG_SOLAR_PANEL) ) {
-            solar_panels.push_back( p );
-        }
         if( vpi.has_flag("FUNNEL") ) {
             funnels.push_back( p );
         }
         if( vpi.has_flag("UNMOUNT_ON_MOVE") ) {
             loose_parts.push_back(p);
         }
-        if( vpi.has_flag( VPFLAG_WHEEL ) ) {
-            wheelcache.push_back( p );
-        }
         if (vpi.has_flag("STEERABLE") || vpi.has_flag("TRACKED")) {
             // TRACKED contributes to steering effectiveness but
             //  (a) doesn't count as a steering axle for install difficulty
@@ -5191,9 +5177,6 @@ void vehicle::refresh()
         if( vpi.has_flag( "CAMERA" ) ) {
             camera_epower += vpi.epower;
         }
-        if( vpi.has_flag( VPFLAG_FLOATS ) ) {
-            floating.push_back( p );
-        }
         if( parts[ p ].enabled ) {
             if( vpi.has_flag( "PLOW" ) ) {
                 extra_drag += vpi.power;
@@ -5211,12 +5194,18 @@ void vehicle::refresh()
         vii = std::lower_bound( relative_parts[pt].begin(), relative_parts[pt].end(), static_cast<int>( p ), svpv );
         relative_parts[pt].insert( vii, p );
     }
+    alternators = parts_by_flag[VPFLAG_ALTERNATOR];
+    engines = parts_by_flag[VPFLAG_ENGINE];
+    solar_panels = parts_by_flag[VPFLAG_SOLAR_PANEL];
+    wheelcache = parts_by_flag[VPFLAG_WHEEL];
+    floating = parts_by_flag[VPFLAG_FLOATS];
 
     // NB: using the _old_ pivot point, don't recalc here, we only do that when moving!
     precalc_mounts( 0, pivot_rotation[0], pivot_anchor[0] );
     check_environmental_effects = true;
     insides_dirty = true;
     invalidate_mass();
+    invalidate_physics();
 }
 
 const point &vehicle::pivot_point() const {
@@ -6489,6 +6478,54 @@ void vehicle::refresh_mass() const
     calc_mass_center( true );
 }
 
+void vehicle::invalidate_physics()
+{
+    physics_dirty = true;
+}
+
+void vehicle::refresh_physics() const
+{
+    physics_dirty = false;
+
+    wheel_area_cache = 0.0f;
+    for( const int wheel_index : wheelcache ) {
+        wheel_area_cache += parts[ wheel_index ].base.wheel_area();
+    }
+    boat_wheel_area_cache = 0.0f;
+    for( const int float_index : floating ) {
+        boat_wheel_area_cache += parts[ float_index ].base.wheel_area();
+    }
+
+    const int max_obst = 13;
+    int obst[max_obst];
+    for( auto &elem : obst ) {
+        elem = 0;
+    }
+    std::vector<int> structure_indices = all_parts_at_location(part_location_structure);
+    for( auto &structure_indice : structure_indices ) {
+        int p = structure_indice;
+        int frame_size = part_with_feature(p, VPFLAG_OBSTACLE) ? 30 : 10;
+        int pos = parts[p].mount.y + max_obst / 2;
+        if (pos < 0) {
+            pos = 0;
+        }
+        if (pos >= max_obst) {
+            pos = max_obst -1;
+        }
+        if (obst[pos] < frame_size) {
+            obst[pos] = frame_size;
+        }
+    }
+    int frame_obst = 0;
+    for( auto &elem : obst ) {
+        frame_obst += elem;
+    }
+    float ae0 = 200.0;
+
+    // calculate aerodynamic coefficient
+    k_aerodynamics_cache = ae0 / ( ae0 + frame_obst );
+}
+
 void vehicle::calc_mass_center( bool use_precalc ) const
 {
     units::quantity<float, units::mass::unit_type> xf = 0;
@@ -838,6 +838,12 @@ public:
      */
     void invalidate_mass();
 
+    /**
+     * Mark the cached wheel areas and aerodynamics as dirty.
+     * Called when parts are added, removed or change their hp.
+     */
+    void invalidate_physics();
+
     // get the total mass of vehicle, including cargo and passengers
     units::mass total_mass () const;
 
@@ -1212,6 +1218,9 @@ public:
     std::vector<int> steering;         // List of STEERABLE parts
     std::vector<int> speciality;       // List of parts that will not be on a vehicle very often, or which only one will be present
     std::vector<int> floating;         // List of parts that provide buoyancy to boats
+    // Indices of the parts having each of the vpart_bitflags, indexed by the flag.
+    // Rebuilt by refresh(), removed parts are not included.
+    std::vector<std::vector<int>> parts_by_flag;
     std::set<std::string> tags;        // Properties of the vehicle
     std::map<itype_id,float> fuel_remainder; // After fuel consumption, this tracks the remainder of fuel < 1, and applies it the next time.
     active_item_cache active_items;
@@ -1291,6 +1300,8 @@ private:
 
     void refresh_mass() const;
     void calc_mass_center( bool precalc ) const;
+    // Recalculates the coefficients that only depend on the installed parts
+    void refresh_physics() const;
 
     /** empty the contents of a tank, battery or turret spilling liquids randomly on the ground */
     void leak_fuel( vehicle_part &pt );
@@ -1308,6 +1319,11 @@ private:
     mutable units::mass mass_cache;
     mutable point mass_center_precalc;
     mutable point mass_center_no_precalc;
+
+    mutable bool physics_dirty                  = true;
+    mutable float wheel_area_cache              = 0.0f;
+    mutable float boat_wheel_area_cache         = 0.0f;
+    mutable float k_aerodynamics_cache          = 0.0f;
 };
 
 #endif
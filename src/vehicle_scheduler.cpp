@@ -0,0 +1,75 @@
+#include "vehicle_scheduler.h"
+
+#include "vehicle.h"
+
+bool vehicle_scheduler::entry::operator<( const entry &rhs ) const
+{
+    if( moving != rhs.moving ) {
+        return moving;
+    }
+    if( moving && of_turn != rhs.of_turn ) {
+        return of_turn > rhs.of_turn;
+    }
+    return order < rhs.order;
+}
+
+void vehicle_scheduler::update( vehicle &veh )
+{
+    const auto iter = entries.find( &veh );
+    // Vehicles get their place among ties when they are first queued
+    int order = next_order;
+    if( iter != entries.end() ) {
+        order = iter->second.order;
+        queue.erase( iter->second );
+        entries.erase( iter );
+    }
+
+    const bool moving = veh.of_turn > 0;
+    if( !moving && !veh.falling ) {
+        return;
+    }
+    if( order == next_order ) {
+        next_order++;
+    }
+
+    const entry e{ moving, veh.of_turn, order, &veh };
+    queue.insert( e );
+    entries.emplace( &veh, e );
+}
+
+void vehicle_scheduler::remove( const vehicle *veh )
+{
+    const auto iter = entries.find( veh );
+    if( iter == entries.end() ) {
+        return;
+    }
+    queue.erase( iter->second );
+    entries.erase( iter );
+}
+
+bool vehicle_scheduler::has( const vehicle *veh ) const
+{
+    return entries.count( veh ) > 0;
+}
+
+vehicle *vehicle_scheduler::top() const
+{
+    return queue.empty() ? nullptr : queue.begin()->veh;
+}
+
+bool vehicle_scheduler::empty() const
+{
+    return queue.empty();
+}
+
+size_t vehicle_scheduler::size() const
+{
+    return queue.size();
+}
+
+void vehicle_scheduler::clear()
+{
+    queue.clear();
+    entries.clear();
+    next_order = 0;
+}
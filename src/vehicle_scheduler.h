@@ -0,0 +1,57 @@
+#pragma once
+#ifndef VEHICLE_SCHEDULER_H
+#define VEHICLE_SCHEDULER_H
+
+#include <cstddef>
+#include <set>
+#include <unordered_map>
+
+class vehicle;
+
+/**
+ * Priority queue of the vehicles that still have to act during the current turn.
+ *
+ * A vehicle is active if it has movement left (`vehicle::of_turn > 0`) or is falling.
+ * Moving vehicles are ordered by the movement they have left, the one with the most
+ * movement first. Vehicles that are only falling come after all moving ones.
+ * Ties are broken by the order in which the vehicles were first scheduled.
+ *
+ * The scheduler does not observe the vehicles: whenever `of_turn` or `falling` of a
+ * vehicle changes, @ref update must be called for it, and a vehicle that is about
+ * to be destroyed must be @ref remove "removed".
+ */
+class vehicle_scheduler
+{
+    public:
+        /**
+         * Inserts the vehicle or moves it to its new position in the queue.
+         * Vehicles that are not active (anymore) are removed instead.
+         */
+        void update( vehicle &veh );
+        /** Removes the vehicle from the queue. The pointer is not dereferenced. */
+        void remove( const vehicle *veh );
+        /** Whether the vehicle is currently in the queue. */
+        bool has( const vehicle *veh ) const;
+        /** The vehicle that should act next, or nullptr if there is none. */
+        vehicle *top() const;
+
+        bool empty() const;
+        size_t size() const;
+        void clear();
+
+    private:
+        struct entry {
+            bool moving;
+            float of_turn;
+            int order;
+            vehicle *veh;
+
+            bool operator<( const entry &rhs ) const;
+        };
+
+        std::set<entry> queue;
+        std::unordered_map<const vehicle *, entry> entries;
+        int next_order = 0;
+};
+
+#endif
@@ -541,6 +541,9 @@ std::list<item> visitable<inventory>::remove_items_with( const
         return res; // nothing to do
     }
 
+    // the binned items could keep pointers to the removed ones
+    inv->binned = false;
+
     for( auto stack = inv->items.begin(); stack != inv->items.end() && count > 0; ) {
         std::list<item> &istack = *stack;
         const auto original_invlet = istack.front().invlet;
@@ -651,6 +654,7 @@ std::list<item> visitable<map_cursor>::remove_items_with( const
             sub->update_lum_rem( *iter, x, y );
 
             // finally remove the item
+            sub->invalidate_item_summary();
             res.splice( res.end(), sub->itm[ x ][ y ], iter++ );
 
             if( --count == 0 ) {
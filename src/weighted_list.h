@@ -95,7 +95,7 @@ template <typename W, typename T> struct weighted_list {
             }
         }
         const T *pick() const {
-            return pick( rand() );
+            return pick( rng( 0, RAND_MAX ) );
         }
 
         /**
@@ -112,7 +112,7 @@ template <typename W, typename T> struct weighted_list {
             }
         }
         T *pick() {
-            return pick( rand() );
+            return pick( rng( 0, RAND_MAX ) );
         }
 
         /**
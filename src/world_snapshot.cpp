@@ -0,0 +1,271 @@
+#include "world_snapshot.h"
+
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "monfaction.h"
+#include "mtype.h"
+#include "npc.h"
+#include "player.h"
+
+#include <algorithm>
+
+static creature_state state_of( const Creature &who )
+{
+    creature_state state;
+    state.who = &who;
+    state.pos = who.pos();
+    state.hp_percentage = who.hp_percentage();
+    state.power_rating = who.power_rating();
+    if( const monster *const mon = dynamic_cast<const monster *>( &who ) ) {
+        state.is_monster = true;
+        state.faction = mon->faction;
+        state.friendly = mon->friendly;
+        state.anger = mon->anger;
+        state.morale = mon->morale;
+        state.dead = mon->is_dead();
+    } else if( const player *const p = dynamic_cast<const player *>( &who ) ) {
+        state.traits = attitude_traits( *p );
+        state.invisible = p->is_invisible();
+        if( const npc *const guy = dynamic_cast<const npc *>( p ) ) {
+            state.faction = guy->get_monster_faction();
+        }
+    }
+    state.is_player = who.is_player();
+    state.hallucination = who.is_hallucination();
+    state.digging = who.digging();
+    state.underwater = who.is_underwater();
+    state.on_divable = state.underwater && g->m.is_divable( state.pos );
+    state.night_invisible = who.has_flag( MF_NIGHT_INVISIBILITY );
+    return state;
+}
+
+world_snapshot::world_snapshot() : u( state_of( g->u ) ),
+    player_faction( mfaction_str_id( "player" ) )
+{
+    states[ u.who ] = &u;
+    int max_z = u.pos.z;
+    min_z = u.pos.z;
+    for( monster &critter : g->all_monsters() ) {
+        monsters.push_back( state_of( critter ) );
+        creature_state &state = monsters.back();
+        states[ &critter ] = &state;
+        // Only 1 faction per mon at the moment.
+        factions[ faction_of( state ) ].push_back( &state );
+        min_z = std::min( min_z, state.pos.z );
+        max_z = std::max( max_z, state.pos.z );
+    }
+    for( npc &guy : g->all_npcs() ) {
+        npcs.push_back( state_of( guy ) );
+        states[ &guy ] = &npcs.back();
+        min_z = std::min( min_z, guy.posz() );
+        max_z = std::max( max_z, guy.posz() );
+    }
+
+    // Without z-levels the map only has the caches of the level the player is on
+    if( !g->m.has_zlevels() ) {
+        min_z = max_z = g->m.get_abs_sub().z;
+    }
+    min_z = std::max( min_z, -OVERMAP_DEPTH );
+    max_z = std::min( max_z, OVERMAP_HEIGHT );
+    levels.resize( std::max( 0, max_z - min_z + 1 ) );
+    for( int z = min_z; z <= max_z; z++ ) {
+        const level_cache &cache = g->m.get_cache_ref( z );
+        level &copy = levels[z - min_z];
+        std::copy( &cache.lm[0][0], &cache.lm[0][0] + MAPSIZE * SEEX * MAPSIZE * SEEY, &copy.lm[0][0] );
+        std::copy( &cache.sm[0][0], &cache.sm[0][0] + MAPSIZE * SEEX * MAPSIZE * SEEY, &copy.sm[0][0] );
+        std::copy( &cache.transparency_cache[0][0],
+                   &cache.transparency_cache[0][0] + MAPSIZE * SEEX * MAPSIZE * SEEY,
+                   &copy.transparency[0][0] );
+        std::copy( &cache.seen_cache[0][0], &cache.seen_cache[0][0] + MAPSIZE * SEEX * MAPSIZE * SEEY,
+                   &copy.seen[0][0] );
+    }
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        natural_light[z + OVERMAP_DEPTH] = g->natural_light_level( z );
+    }
+}
+
+mfaction_id world_snapshot::faction_of( const creature_state &state ) const
+{
+    return state.friendly == 0 ? state.faction : player_faction;
+}
+
+void world_snapshot::update( const Creature &who )
+{
+    const auto found = states.find( &who );
+    if( found == states.end() ) {
+        if( who.is_monster() ) {
+            monsters.push_back( state_of( who ) );
+            states[ &who ] = &monsters.back();
+            factions[ faction_of( monsters.back() ) ].push_back( &monsters.back() );
+        }
+        return;
+    }
+    creature_state &state = *found->second;
+    const creature_state old = state;
+    state = state_of( who );
+    if( state.is_monster && faction_of( state ) != faction_of( old ) ) {
+        auto &members = factions[ faction_of( old ) ];
+        members.erase( std::remove( members.begin(), members.end(), &state ), members.end() );
+        factions[ faction_of( state ) ].push_back( &state );
+    }
+}
+
+const world_snapshot::level *world_snapshot::level_at( const tripoint &p ) const
+{
+    if( p.z < min_z || p.z >= min_z + static_cast<int>( levels.size() ) ||
+        p.x < 0 || p.x >= MAPSIZE * SEEX || p.y < 0 || p.y >= MAPSIZE * SEEY ) {
+        return nullptr;
+    }
+    return &levels[p.z - min_z];
+}
+
+lit_level world_snapshot::light_at( const tripoint &p ) const
+{
+    const level *const lev = level_at( p );
+    if( lev == nullptr ) {
+        return LL_DARK;
+    }
+    if( lev->sm[p.x][p.y] >= LIGHT_SOURCE_BRIGHT ) {
+        return LL_BRIGHT;
+    }
+    if( lev->lm[p.x][p.y] >= LIGHT_AMBIENT_LIT ) {
+        return LL_LIT;
+    }
+    if( lev->lm[p.x][p.y] >= LIGHT_AMBIENT_LOW ) {
+        return LL_LOW;
+    }
+    return LL_DARK;
+}
+
+float world_snapshot::ambient_light_at( const tripoint &p ) const
+{
+    const level *const lev = level_at( p );
+    return lev == nullptr ? 0.0f : lev->lm[p.x][p.y];
+}
+
+bool world_snapshot::trans( const tripoint &p ) const
+{
+    const level *const lev = level_at( p );
+    return lev != nullptr && lev->transparency[p.x][p.y] > LIGHT_TRANSPARENCY_SOLID;
+}
+
+bool world_snapshot::sees( const monster &viewer, const creature_state &target ) const
+{
+    if( target.hallucination || target.invisible ) {
+        // Only the player sees hallucinations, and monsters never see invisible players
+        return false;
+    }
+
+    const tripoint &pos = viewer.pos();
+    if( !fov_3d && !debug_mode && pos.z != target.pos.z ) {
+        return false;
+    }
+
+    const int wanted_range = rl_dist( pos, target.pos );
+    if( wanted_range <= 1 &&
+        ( pos.z == target.pos.z || g->m.valid_move( pos, target.pos, false, true ) ) ) {
+        return true;
+    } else if( ( wanted_range > 1 && target.digging ) ||
+               ( target.night_invisible && light_at( target.pos ) <= LL_LOW ) ||
+               ( target.underwater && !viewer.is_underwater() && target.on_divable ) ) {
+        return false;
+    }
+
+    return sees( viewer, target.pos, target.is_player );
+}
+
+bool world_snapshot::sees( const monster &viewer, const tripoint &t, const bool is_player ) const
+{
+    const tripoint &pos = viewer.pos();
+    if( !fov_3d && pos.z != t.z ) {
+        return false;
+    }
+
+    const float ambient = ambient_light_at( t );
+    const float natural = natural_light[t.z + OVERMAP_DEPTH];
+    const int range_cur = viewer.sight_range( ambient );
+    const int range_day = viewer.sight_range( DAYLIGHT_LEVEL );
+    const int range_night = viewer.sight_range( 0 );
+    const int range_max = std::max( range_day, range_night );
+    const int range_min = std::min( range_cur, range_max );
+    const int wanted_range = rl_dist( pos, t );
+    if( wanted_range > range_min && ( wanted_range > range_max || ambient <= natural ) ) {
+        return false;
+    }
+    const int range = ambient > natural ? wanted_range : range_min;
+    if( is_player ) {
+        // Special case monster -> player visibility, forcing it to be symmetric with player vision.
+        const level *const lev = level_at( pos );
+        return range >= wanted_range && lev != nullptr &&
+               lev->seen[pos.x][pos.y] > LIGHT_TRANSPARENCY_SOLID;
+    }
+    return line_of_sight( pos, t, range );
+}
+
+bool world_snapshot::line_of_sight( const tripoint &from, const tripoint &to,
+                                    const int range ) const
+{
+    if( ( range >= 0 && range < rl_dist( from, to ) ) || level_at( to ) == nullptr ) {
+        return false;
+    }
+    bool visible = true;
+    int bresenham_slope = 0;
+
+    if( !fov_3d || from.z == to.z ) {
+        bresenham( from.x, from.y, to.x, to.y, bresenham_slope,
+        [this, &visible, &to]( const point & new_point ) {
+            // Exit before checking the last square, it's still visible even if opaque.
+            if( new_point.x == to.x && new_point.y == to.y ) {
+                return false;
+            }
+            if( !trans( tripoint( new_point, to.z ) ) ) {
+                visible = false;
+                return false;
+            }
+            return true;
+        } );
+        return visible;
+    }
+
+    tripoint last_point = from;
+    bresenham( from, to, bresenham_slope, 0,
+    [this, &visible, &to, &last_point]( const tripoint & new_point ) {
+        // Exit before checking the last square, it's still visible even if opaque.
+        if( new_point == to ) {
+            return false;
+        }
+
+        if( new_point.z == last_point.z ) {
+            if( !trans( new_point ) ) {
+                visible = false;
+                return false;
+            }
+        } else {
+            const int max_z = std::max( new_point.z, last_point.z );
+            if( ( g->m.has_floor_or_support( { new_point.x, new_point.y, max_z } ) ||
+                  !trans( { new_point.x, new_point.y, last_point.z } ) ) &&
+                ( g->m.has_floor_or_support( { last_point.x, last_point.y, max_z } ) ||
+                  !trans( { last_point.x, last_point.y, new_point.z } ) ) ) {
+                visible = false;
+                return false;
+            }
+        }
+
+        last_point = new_point;
+        return true;
+    } );
+    return visible;
+}
+
+Creature::Attitude world_snapshot::attitude_to( const monster &viewer,
+        const creature_state &target ) const
+{
+    if( target.who == &viewer ) {
+        return Creature::A_FRIENDLY;
+    } else if( target.is_monster ) {
+        return monster::attitude_between( viewer.faction, viewer.friendly, viewer.morale,
+                                          viewer.anger, target.faction, target.friendly );
+    }
+    return monster::attitude_for( viewer.attitude( target.traits ) );
+}
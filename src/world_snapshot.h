@@ -0,0 +1,108 @@
+#pragma once
+#ifndef WORLD_SNAPSHOT_H
+#define WORLD_SNAPSHOT_H
+
+#include "game_constants.h"
+#include "lightmap.h"
+#include "monster.h"
+
+#include <array>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * What monster planning knows about a creature, copied when the snapshot is taken.
+ */
+struct creature_state {
+    /** Only to tell creatures apart, planning must not look at the creature itself. */
+    const Creature *who = nullptr;
+    tripoint pos;
+    int hp_percentage = 0;
+    float power_rating = 0;
+
+    bool is_monster = false;
+    /** For monsters, see the members of the same name. For npcs, their monster faction. */
+    mfaction_id faction;
+    int friendly = 0;
+    int anger = 0;
+    int morale = 0;
+    bool dead = false;
+    /** For characters. */
+    attitude_traits traits;
+
+    /** The things @ref Creature::sees checks about the creature being looked at. */
+    bool is_player = false;
+    bool invisible = false;
+    bool hallucination = false;
+    bool digging = false;
+    bool underwater = false;
+    bool on_divable = false;
+    bool night_invisible = false;
+};
+
+/**
+ * What monster planning (@ref monster::plan_intent) gets to look at, taken in game::monmove
+ * after the map caches were built. Only taken with the "PARALLEL_MONSTER_PLANNING" option,
+ * serial planning (@ref monster::plan) looks at the live creatures.
+ *
+ * The creatures are copied into @ref creature_state, and the light, transparency and seen
+ * caches and natural light levels of the z-levels they are on. So nothing the monsters do
+ * while the plans are applied changes what the other monsters planned from, and the planning
+ * of all monsters can run at the same time.
+ * The terrain is still looked at on the map, it doesn't change while monsters plan.
+ */
+class world_snapshot
+{
+    public:
+        /** Takes the snapshot from the current game. */
+        world_snapshot();
+        world_snapshot( const world_snapshot & ) = delete;
+        world_snapshot &operator=( const world_snapshot & ) = delete;
+
+        /**
+         * Copies the creature into the snapshot again, or adds it if it's a monster that
+         * wasn't there yet. Monsters that plan later in the turn see it as it is now.
+         */
+        void update( const Creature &who );
+
+        /** Like @ref Creature::sees, from the copied caches. */
+        bool sees( const monster &viewer, const creature_state &target ) const;
+        /** Like @ref monster::attitude_to. */
+        Creature::Attitude attitude_to( const monster &viewer, const creature_state &target ) const;
+
+        /** All monsters, in the order of game::all_monsters. */
+        std::deque<creature_state> monsters;
+        /** The monsters by faction, monsters friendly to the player are in @ref player_faction. */
+        std::map<mfaction_id, std::vector<const creature_state *>> factions;
+        std::deque<creature_state> npcs;
+        creature_state u;
+        mfaction_id player_faction;
+
+    private:
+        struct level {
+            float lm[MAPSIZE * SEEX][MAPSIZE * SEEY];
+            float sm[MAPSIZE * SEEX][MAPSIZE * SEEY];
+            float transparency[MAPSIZE * SEEX][MAPSIZE * SEEY];
+            float seen[MAPSIZE * SEEX][MAPSIZE * SEEY];
+        };
+
+        const level *level_at( const tripoint &p ) const;
+        lit_level light_at( const tripoint &p ) const;
+        float ambient_light_at( const tripoint &p ) const;
+        bool trans( const tripoint &p ) const;
+        bool sees( const monster &viewer, const tripoint &t, bool is_player ) const;
+        /** Like @ref map::sees. */
+        bool line_of_sight( const tripoint &from, const tripoint &to, int range ) const;
+
+        mfaction_id faction_of( const creature_state &state ) const;
+
+        /** The copied caches of the z-levels from @ref min_z on. */
+        std::vector<level> levels;
+        int min_z = 0;
+        std::array<float, OVERMAP_LAYERS> natural_light;
+        std::unordered_map<const Creature *, creature_state *> states;
+};
+
+#endif
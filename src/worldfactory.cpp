@@ -246,6 +246,7 @@ WORLDPTR worldfactory::convert_to_world(std::string origin_path)
 void worldfactory::set_active_world(WORLDPTR world)
 {
     world_generator->active_world = world;
+    get_options().invalidate_handles();
 }
 
 bool worldfactory::save_world(WORLDPTR world, bool is_conversion)
@@ -308,6 +309,7 @@ void worldfactory::init()
         delete elem.second;
     }
     all_worlds.clear();
+    get_options().invalidate_handles();
 
     // get the master files. These determine the validity of a world
     // worlds exist by having an option file
@@ -576,6 +578,7 @@ void worldfactory::remove_world(std::string worldname)
         WORLDPTR wptr = it->second;
         if( active_world == wptr ) {
             active_world = nullptr;
+            get_options().invalidate_handles();
         }
         delete wptr;
         all_worlds.erase( it );
@@ -1388,6 +1391,7 @@ void WORLD::load_legacy_options( std::istream &fin )
 bool worldfactory::load_world_options(WORLDPTR &world)
 {
     world->WORLD_OPTIONS = get_options().get_world_defaults();
+    get_options().invalidate_handles();
 
     using namespace std::placeholders;
     const auto path = world->folder_path() + "/" + FILENAMES["worldoptions"];
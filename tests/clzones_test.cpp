@@ -0,0 +1,118 @@
+#include "catch/catch.hpp"
+
+#include "clzones.h"
+#include "rng.h"
+
+#include <chrono>
+#include <cstdio>
+#include <unordered_set>
+#include <vector>
+
+static const zone_type_id zone_no_auto_pickup( "NO_AUTO_PICKUP" );
+static const zone_type_id zone_no_npc_pickup( "NO_NPC_PICKUP" );
+
+static bool in_box( const tripoint &p, const tripoint &min, const tripoint &max )
+{
+    return p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y &&
+           p.z >= min.z && p.z <= max.z;
+}
+
+static void check_zones( const zone_manager &zones )
+{
+    const std::unordered_set<tripoint> auto_pickup = zones.get_point_set( zone_no_auto_pickup );
+    const std::unordered_set<tripoint> npc_pickup = zones.get_point_set( zone_no_npc_pickup );
+    for( int x = -2; x < 42; x++ ) {
+        for( int y = -2; y < 42; y++ ) {
+            for( int z = -1; z <= 1; z++ ) {
+                const tripoint p( x, y, z );
+                for( const zone_type_id &type : { zone_no_auto_pickup, zone_no_npc_pickup } ) {
+                    bool expected = false;
+                    for( const zone_manager::zone_data &zone : zones.zones ) {
+                        expected = expected || ( zone.get_enabled() && zone.get_type() == type &&
+                                                 in_box( p, zone.get_start_point(), zone.get_end_point() ) );
+                    }
+                    INFO( "point " << p << " type " << type.str() );
+                    REQUIRE( zones.has( type, p ) == expected );
+                    const auto &points = type == zone_no_auto_pickup ? auto_pickup : npc_pickup;
+                    REQUIRE( points.count( p ) == ( expected ? 1 : 0 ) );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "zone_index_matches_zone_areas" )
+{
+    const rng_seed_scope seeded_rng( 49 );
+    zone_manager zones;
+    for( int i = 0; i < 20; i++ ) {
+        const tripoint start( rng( 0, 35 ), rng( 0, 35 ), rng( -1, 1 ) );
+        const tripoint end = start + tripoint( rng( -1, 6 ), rng( 0, 6 ), rng( 0, 1 ) );
+        zones.add( "zone", one_in( 3 ) ? zone_no_npc_pickup : zone_no_auto_pickup, false,
+                   !one_in( 5 ), start, end );
+    }
+    // The same area twice, removing one of them must keep it in the zone
+    zones.add( "twin", zone_no_auto_pickup, false, true, tripoint( 38, 38, 0 ),
+               tripoint( 40, 40, 0 ) );
+    zones.add( "twin", zone_no_auto_pickup, false, true, tripoint( 38, 38, 0 ),
+               tripoint( 40, 40, 0 ) );
+    check_zones( zones );
+
+    SECTION( "removing zones" ) {
+        zones.remove( zones.zones.size() - 1 );
+        CHECK( zones.has( zone_no_auto_pickup, tripoint( 39, 39, 0 ) ) );
+        while( zones.zones.size() > 10 ) {
+            zones.remove( rng( 0, zones.zones.size() - 1 ) );
+        }
+        check_zones( zones );
+        CHECK_FALSE( zones.remove( zones.zones.size() ) );
+    }
+
+    SECTION( "editing zones in place" ) {
+        for( zone_manager::zone_data &zone : zones.zones ) {
+            zone.set_enabled( !zone.get_enabled() );
+        }
+        zones.cache_data();
+        check_zones( zones );
+    }
+}
+
+TEST_CASE( "zone_lookup_performance", "[.]" )
+{
+    // A camp with a grid of storage zones of 10x10 tiles on a few levels
+    zone_manager zones;
+    for( int x = 0; x < 200; x += 12 ) {
+        for( int y = 0; y < 200; y += 12 ) {
+            zones.add( "storage", zone_no_npc_pickup, false, true, tripoint( x, y, -1 ),
+                       tripoint( x + 9, y + 9, 1 ) );
+        }
+    }
+    // The old cache held every tile of every zone
+    const std::unordered_set<tripoint> tiles = zones.get_point_set( zone_no_npc_pickup );
+
+    const int lookups = 1000000;
+    std::vector<tripoint> points;
+    for( int i = 0; i < lookups; i++ ) {
+        points.emplace_back( rng( -10, 210 ), rng( -10, 210 ), rng( -1, 1 ) );
+    }
+    int index_hits = 0;
+    const auto index_start = std::chrono::high_resolution_clock::now();
+    for( const tripoint &p : points ) {
+        index_hits += zones.has( zone_no_npc_pickup, p ) ? 1 : 0;
+    }
+    const auto index_end = std::chrono::high_resolution_clock::now();
+    int tile_hits = 0;
+    for( const tripoint &p : points ) {
+        tile_hits += tiles.count( p );
+    }
+    const auto tiles_end = std::chrono::high_resolution_clock::now();
+    CHECK( index_hits == tile_hits );
+
+    const long index_diff = std::chrono::duration_cast<std::chrono::microseconds>
+                            ( index_end - index_start ).count();
+    const long tiles_diff = std::chrono::duration_cast<std::chrono::microseconds>
+                            ( tiles_end - index_end ).count();
+    printf( "%d lookups in %d zones took %ld us with the zone index, %ld us with a set of %d tiles\n",
+            lookups, static_cast<int>( zones.zones.size() ), index_diff, tiles_diff,
+            static_cast<int>( tiles.size() ) );
+}
@@ -0,0 +1,113 @@
+#include "catch/catch.hpp"
+
+#include "calendar.h"
+#include "creature.h"
+#include "effect.h"
+#include "game.h"
+#include "monster.h"
+#include "player.h"
+
+#include "map_helpers.h"
+#include "player_helpers.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+static const efftype_id effect_bleed( "bleed" );
+static const efftype_id effect_deaf( "deaf" );
+static const efftype_id effect_hit_by_player( "hit_by_player" );
+static const efftype_id effect_poison( "poison" );
+
+TEST_CASE( "effects_on_body_parts" )
+{
+    clear_player();
+    player &dummy = g->u;
+    dummy.clear_effects();
+
+    dummy.add_effect( effect_bleed, 1_hours, bp_arm_l );
+    dummy.add_effect( effect_bleed, 1_hours, bp_leg_r );
+    dummy.add_effect( effect_poison, 1_hours );
+    dummy.add_effect( effect_deaf, 1_hours );
+
+    CHECK( dummy.has_effect( effect_bleed ) );
+    CHECK( dummy.has_effect( effect_bleed, bp_arm_l ) );
+    CHECK( dummy.has_effect( effect_bleed, bp_leg_r ) );
+    CHECK_FALSE( dummy.has_effect( effect_bleed, bp_head ) );
+    CHECK( dummy.has_effect( effect_poison ) );
+    CHECK( dummy.get_effect( effect_bleed, bp_leg_r ).get_bp() == bp_leg_r );
+    CHECK( dummy.get_effect( effect_bleed, bp_head ).is_null() );
+
+    SECTION( "adding again extends the existing effect" ) {
+        const time_duration before = dummy.get_effect_dur( effect_deaf );
+        dummy.add_effect( effect_deaf, 1_hours );
+        CHECK( dummy.get_effect_dur( effect_deaf ) > before );
+    }
+
+    SECTION( "removing one body part keeps the others" ) {
+        CHECK( dummy.remove_effect( effect_bleed, bp_arm_l ) );
+        CHECK_FALSE( dummy.has_effect( effect_bleed, bp_arm_l ) );
+        CHECK( dummy.has_effect( effect_bleed ) );
+        CHECK( dummy.remove_effect( effect_bleed, bp_leg_r ) );
+        CHECK_FALSE( dummy.has_effect( effect_bleed ) );
+        CHECK( dummy.has_effect( effect_poison ) );
+    }
+
+    SECTION( "removing without a body part removes all of them" ) {
+        CHECK( dummy.remove_effect( effect_bleed ) );
+        CHECK_FALSE( dummy.has_effect( effect_bleed ) );
+        CHECK_FALSE( dummy.remove_effect( effect_bleed ) );
+        CHECK( dummy.has_effect( effect_deaf ) );
+    }
+
+    dummy.clear_effects();
+    CHECK_FALSE( dummy.has_effect( effect_poison ) );
+    CHECK_FALSE( dummy.has_effect( effect_deaf ) );
+}
+
+TEST_CASE( "copied_monster_keeps_its_own_effects" )
+{
+    clear_map();
+    monster &original = spawn_test_monster( "mon_zombie", g->u.pos() + tripoint( 5, 0, 0 ) );
+    original.add_effect( effect_poison, 1_hours );
+
+    monster copy = original;
+    CHECK( copy.has_effect( effect_poison ) );
+    copy.remove_effect( effect_poison );
+    CHECK_FALSE( copy.has_effect( effect_poison ) );
+    CHECK( original.has_effect( effect_poison ) );
+}
+
+// Monsters check a handful of effects each time they act, this measures how long a
+// horde takes to move while carrying some common ones.
+TEST_CASE( "monmove_horde_with_effects_performance", "[.]" )
+{
+    clear_map();
+    const tripoint origin = g->u.pos();
+    int spawned = 0;
+    for( int y = -15; y < 15 && spawned < 300; y++ ) {
+        for( int x = 10; x < 30 && spawned < 300; x += 2 ) {
+            monster &critter = spawn_test_monster( "mon_zombie", origin + tripoint( x, y, 0 ) );
+            critter.add_effect( effect_poison, 1_hours );
+            critter.add_effect( effect_deaf, 1_hours );
+            critter.add_effect( effect_hit_by_player, 1_hours );
+            spawned++;
+        }
+    }
+    REQUIRE( spawned == 300 );
+
+    const int turns = 20;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < turns; i++ ) {
+        for( monster &critter : g->all_monsters() ) {
+            critter.mod_moves( critter.get_speed() );
+        }
+        g->monmove();
+        calendar::turn.increment();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d turns of monmove with %d monsters took %ld us\n", turns, spawned, diff );
+
+    clear_map();
+}
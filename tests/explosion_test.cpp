@@ -0,0 +1,135 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "mapdata.h"
+#include "monster.h"
+#include "player.h"
+
+#include "map_helpers.h"
+
+#include <chrono>
+#include <cstdio>
+#include <unordered_map>
+
+TEST_CASE( "blast_is_stopped_by_walls" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    monster &near = spawn_test_monster( "mon_zombie", center + tripoint( 2, 0, 0 ) );
+    monster &far = spawn_test_monster( "mon_zombie", center + tripoint( 15, 0, 0 ) );
+    // A zombie in a metal box, which is too sturdy for the blast to break open
+    const tripoint boxed_pos = center + tripoint( -3, 0, 0 );
+    for( int x = -1; x <= 1; x++ ) {
+        for( int y = -1; y <= 1; y++ ) {
+            if( x != 0 || y != 0 ) {
+                g->m.ter_set( boxed_pos + tripoint( x, y, 0 ), t_wall_metal );
+            }
+        }
+    }
+    monster &boxed = spawn_test_monster( "mon_zombie", boxed_pos );
+    const int full_hp = near.get_hp();
+
+    g->do_blast( center, 10.0f, 0.8f, false );
+
+    CHECK( near.get_hp() < full_hp );
+    CHECK( far.get_hp() == full_hp );
+    CHECK( boxed.get_hp() == full_hp );
+    CHECK( g->m.ter( boxed_pos + tripoint( 1, 0, 0 ) ) == t_wall_metal );
+
+    clear_map();
+}
+
+TEST_CASE( "shrapnel_hits_creatures_in_the_open" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    monster &near = spawn_test_monster( "mon_zombie", center + tripoint( 2, 0, 0 ) );
+    const tripoint boxed_pos = center + tripoint( -4, 0, 0 );
+    for( int x = -1; x <= 1; x++ ) {
+        for( int y = -1; y <= 1; y++ ) {
+            if( x != 0 || y != 0 ) {
+                g->m.ter_set( boxed_pos + tripoint( x, y, 0 ), t_wall_metal );
+            }
+        }
+    }
+    monster &boxed = spawn_test_monster( "mon_zombie", boxed_pos );
+    const int full_hp = near.get_hp();
+
+    const int range = 8;
+    const std::unordered_map<tripoint, int> distrib = g->shrapnel( center, 20, 500, 10, range );
+
+    CHECK( near.get_hp() < full_hp );
+    CHECK( boxed.get_hp() == full_hp );
+    CHECK( distrib.count( boxed_pos ) == 0 );
+    CHECK( distrib.at( boxed_pos + tripoint( 1, 0, 0 ) ) > 0 );
+    for( const auto &e : distrib ) {
+        CHECK( square_dist( center, e.first ) <= range );
+    }
+
+    clear_map();
+}
+
+// Rooms of 5x5 tiles with a door and a table each, like a dense town. The radius must
+// be a multiple of 6.
+static void build_rooms( const tripoint &center, const int radius )
+{
+    for( int x = center.x - radius; x <= center.x + radius; x++ ) {
+        for( int y = center.y - radius; y <= center.y + radius; y++ ) {
+            const int room_x = ( x - center.x + radius + 3 ) % 6;
+            const int room_y = ( y - center.y + radius + 3 ) % 6;
+            g->m.furn_set( x, y, f_null );
+            if( room_x == 0 && room_y == 3 ) {
+                g->m.ter_set( x, y, t_door_c );
+            } else if( room_x == 0 || room_y == 0 ) {
+                g->m.ter_set( x, y, t_wall );
+            } else {
+                g->m.ter_set( x, y, t_floor );
+                if( room_x == 2 && room_y == 2 ) {
+                    g->m.furn_set( x, y, f_table );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "urban_blast_performance", "[.]" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    const int blasts = 20;
+    long diff = 0;
+    for( int i = 0; i < blasts; i++ ) {
+        build_rooms( center, 36 );
+        const auto start = std::chrono::high_resolution_clock::now();
+        g->do_blast( center, 1000.0f, 0.8f, false );
+        const auto end = std::chrono::high_resolution_clock::now();
+        diff += std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    }
+    printf( "%d power 1000 blasts among buildings took %ld us\n", blasts, diff );
+    clear_map();
+}
+
+TEST_CASE( "urban_shrapnel_performance", "[.]" )
+{
+    clear_map();
+    const tripoint center( 60, 60, 0 );
+    build_rooms( center, 18 );
+    for( int x = -9; x <= 9; x += 3 ) {
+        for( int y = -9; y <= 9; y += 3 ) {
+            if( g->m.passable( center + tripoint( x, y, 0 ) ) && ( x != 0 || y != 0 ) ) {
+                spawn_test_monster( "mon_zombie", center + tripoint( x, y, 0 ) );
+            }
+        }
+    }
+    const int explosions = 100;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < explosions; i++ ) {
+        g->shrapnel( center, 50, 500, 10 );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d explosions of 500 fragments among buildings took %ld us\n", explosions, diff );
+    clear_map();
+}
@@ -0,0 +1,66 @@
+#include "catch/catch.hpp"
+
+#include "calendar.h"
+#include "inventory.h"
+#include "item.h"
+#include "units.h"
+
+static void check_totals( const inventory &inv )
+{
+    units::mass weight = 0;
+    units::volume volume = 0;
+    for( const std::list<item> *stack : inv.const_slice() ) {
+        for( const item &it : *stack ) {
+            weight += it.weight();
+            volume += it.volume();
+        }
+    }
+    CHECK( to_gram( inv.weight() ) == to_gram( weight ) );
+    CHECK( to_milliliter( inv.volume() ) == to_milliliter( volume ) );
+}
+
+TEST_CASE( "inventory_totals_match_items" )
+{
+    inventory inv;
+    check_totals( inv );
+
+    inv.add_item( item( "rock" ) );
+    check_totals( inv );
+    inv.add_item( item( "rock" ) );
+    inv.add_item( item( "hammer" ) );
+    item &water = inv.add_item( item( "bottle_plastic" ) );
+    check_totals( inv );
+
+    SECTION( "changing items in place" ) {
+        water.put_in( item( "water_clean", calendar::turn, 2 ) );
+        inv.unsort();
+        check_totals( inv );
+
+        inv.visit_items( []( item * e ) {
+            if( e->typeId() == "water_clean" ) {
+                e->charges = 1;
+            }
+            return VisitResponse::NEXT;
+        } );
+        check_totals( inv );
+
+        inv.find_item( 0 ).set_var( "weight", 5000 );
+        check_totals( inv );
+    }
+
+    SECTION( "removing items" ) {
+        inv.remove_item( &water );
+        check_totals( inv );
+        inv.use_amount( "rock", 1 );
+        check_totals( inv );
+        inv.remove_items_with( []( const item & e ) {
+            return e.typeId() == "hammer";
+        } );
+        check_totals( inv );
+        inv.reduce_stack( 0, 1 );
+        check_totals( inv );
+        inv.clear();
+        check_totals( inv );
+        CHECK( to_gram( inv.weight() ) == 0 );
+    }
+}
@@ -0,0 +1,115 @@
+#include "catch/catch.hpp"
+
+#include "flag.h"
+#include "game.h"
+#include "item.h"
+#include "itype.h"
+#include "player.h"
+#include "player_helpers.h"
+#include "units.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+// Constructed before the flag definitions are loaded
+static const flag_id flag_DIAMOND( "DIAMOND" );
+
+TEST_CASE( "flag_set_follows_members" )
+{
+    const flag_id fit( "FIT" );
+    const flag_id wet( "WET" );
+
+    flag_set flags;
+    CHECK_FALSE( flags.has( fit ) );
+    CHECK_FALSE( flags.has( flag_id() ) );
+
+    flags.insert( "FIT" );
+    CHECK( flags.has( fit ) );
+    CHECK_FALSE( flags.has( wet ) );
+    CHECK( flags.count( "FIT" ) == 1 );
+
+    flags.insert( "WET" );
+    flags.erase( "FIT" );
+    CHECK_FALSE( flags.has( fit ) );
+    CHECK( flags.has( wet ) );
+    CHECK( flags.find( "FIT" ) == flags.end() );
+
+    flags = std::set<std::string> { "FIT" };
+    CHECK( flags.has( fit ) );
+    CHECK_FALSE( flags.has( wet ) );
+
+    flags.clear();
+    CHECK( flags.empty() );
+    CHECK_FALSE( flags.has( fit ) );
+
+    CHECK( flag_id::find( "NO_SUCH_FLAG_EVER_INTERNED" ).is_null() );
+    CHECK( flag_id( "WET" ) == wet );
+    CHECK( wet.str() == "WET" );
+}
+
+TEST_CASE( "flag_ids_know_whether_flags_are_inherited" )
+{
+    CHECK_FALSE( json_flag::get( "DIAMOND" ).inherit() );
+    CHECK_FALSE( flag_DIAMOND.inherit() );
+    CHECK( flag_id( "FIT" ).inherit() == json_flag::get( "FIT" ).inherit() );
+    CHECK( flag_id( "NO_SUCH_FLAG_DEFINED" ).inherit() );
+}
+
+TEST_CASE( "flags_interned_on_other_threads_are_found" )
+{
+    // Not found here first, so this thread must not remember the miss
+    CHECK( flag_id::find( "FLAG_INTERNED_ON_OTHER_THREAD" ).is_null() );
+    flag_id interned;
+    std::thread( [&interned]() {
+        interned = flag_id( "FLAG_INTERNED_ON_OTHER_THREAD" );
+    } ).join();
+    CHECK_FALSE( interned.is_null() );
+    CHECK( flag_id::find( "FLAG_INTERNED_ON_OTHER_THREAD" ) == interned );
+    CHECK( interned.str() == "FLAG_INTERNED_ON_OTHER_THREAD" );
+    CHECK( interned.inherit() );
+}
+
+TEST_CASE( "item_has_flag_by_id_matches_string_lookup" )
+{
+    item knife( "knife_combat" );
+    item shirt( "longshirt" );
+    shirt.set_flag( "FIT" );
+
+    for( const item *it : { &knife, &shirt } ) {
+        for( const std::string &flag : it->type->item_tags ) {
+            CHECK( it->has_flag( flag_id( flag ) ) );
+        }
+        for( const char *flag : { "FIT", "VARSIZE", "NO_DROP", "STAB" } ) {
+            CHECK( it->has_flag( flag_id( flag ) ) == it->has_flag( flag ) );
+        }
+    }
+    CHECK( shirt.has_flag( flag_id( "FIT" ) ) );
+    shirt.unset_flag( "FIT" );
+    CHECK_FALSE( shirt.item_tags.has( flag_id( "FIT" ) ) );
+}
+
+TEST_CASE( "weight_carried_performance", "[.]" )
+{
+    clear_player();
+    player &dummy = g->u;
+    dummy.wear_item( item( "backpack" ), false );
+    dummy.wear_item( item( "jeans" ), false );
+    dummy.wear_item( item( "longshirt" ), false );
+    item gun( "glock_19" );
+    dummy.wield( gun );
+    for( int i = 0; i < 50; i++ ) {
+        dummy.i_add( item( i % 2 ? "can_beans" : "rag" ) );
+    }
+
+    const int iterations = 10000;
+    units::mass total = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        total += dummy.weight_carried();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d calls of weight_carried took %ld us (%d g)\n", iterations, diff,
+            static_cast<int>( to_gram( total ) / iterations ) );
+}
@@ -0,0 +1,129 @@
+#include "catch/catch.hpp"
+
+#include "item.h"
+#include "item_vars.h"
+#include "json.h"
+#include "units.h"
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+static std::string vars_to_json( const item_var_map &vars )
+{
+    std::ostringstream os;
+    JsonOut jsout( os );
+    vars.serialize( jsout );
+    return os.str();
+}
+
+static item_var_map vars_from_json( const std::string &text )
+{
+    std::istringstream is( text );
+    JsonIn jsin( is );
+    item_var_map vars;
+    vars.deserialize( jsin );
+    return vars;
+}
+
+TEST_CASE( "item_vars_behave_like_strings" )
+{
+    item it( "rock" );
+    it.set_var( "int", 5 );
+    it.set_var( "double", 0.25 );
+    it.set_var( "text", "hello" );
+    it.set_var( "numeric_text", "42" );
+
+    CHECK( it.get_var( "int", 0 ) == 5 );
+    CHECK( it.get_var( "int" ) == "5" );
+    CHECK( it.get_var( "double", 0.0 ) == 0.25 );
+    CHECK( it.get_var( "double" ) == "0.250000" );
+    CHECK( it.get_var( "text" ) == "hello" );
+    CHECK( it.get_var( "text", 1.0 ) == 0.0 );
+    CHECK( it.get_var( "numeric_text", 0 ) == 42 );
+    CHECK( it.get_var( "missing", 7 ) == 7 );
+    CHECK( it.get_var( "missing", "default" ) == "default" );
+    CHECK_FALSE( it.has_var( "missing" ) );
+}
+
+TEST_CASE( "item_var_map_compares_and_saves_as_text" )
+{
+    const item_var_key int_key( "int" );
+    const item_var_key double_key( "double" );
+    const item_var_key text_key( "text" );
+
+    item_var_map vars;
+    vars.set( int_key, 5l );
+    vars.set( double_key, 0.25 );
+    vars.set( text_key, std::string( "hello" ) );
+
+    SECTION( "values with the same text compare equal" ) {
+        item_var_map other;
+        other.set( text_key, std::string( "hello" ) );
+        other.set( int_key, std::string( "5" ) );
+        other.set( double_key, std::string( "0.250000" ) );
+        CHECK( vars == other );
+        other.set( double_key, 0.2500001 );
+        CHECK( vars == other );
+        other.erase( text_key );
+        CHECK( vars != other );
+    }
+
+    SECTION( "saved like a map of strings" ) {
+        const std::string json = vars_to_json( vars );
+        CHECK( json == "{\"double\":\"0.250000\",\"int\":\"5\",\"text\":\"hello\"}" );
+        CHECK( vars_from_json( json ) == vars );
+    }
+}
+
+// Item weight and volume read item variables for every item. A plain vector is used
+// because inventory caches its totals.
+TEST_CASE( "item_var_keys_can_be_interned_on_several_threads" )
+{
+    std::vector<item_var_key> keys( 4 );
+    std::vector<std::thread> threads;
+    for( size_t i = 0; i < keys.size(); i++ ) {
+        threads.emplace_back( [&keys, i]() {
+            keys[i] = item_var_key( "var_interned_on_threads" );
+        } );
+    }
+    for( std::thread &t : threads ) {
+        t.join();
+    }
+    for( const item_var_key &key : keys ) {
+        CHECK( key == keys.front() );
+    }
+    CHECK( item_var_key::find( "var_interned_on_threads" ) == keys.front() );
+    CHECK( keys.front().str() == "var_interned_on_threads" );
+}
+
+TEST_CASE( "item_weight_volume_performance", "[.]" )
+{
+    std::vector<item> items;
+    for( int i = 0; i < 1000; i++ ) {
+        items.emplace_back( i % 2 ? "rock" : "hammer" );
+        if( i % 4 == 0 ) {
+            items.back().set_var( "weight", 500 + i );
+            items.back().set_var( "item_note", "scratched" );
+        }
+    }
+
+    const int iterations = 100;
+    units::mass weight = 0;
+    units::volume volume = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        for( const item &it : items ) {
+            weight += it.weight();
+            volume += it.volume();
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d passes over %d items took %ld us (%d g, %d ml)\n", iterations,
+            static_cast<int>( items.size() ), diff,
+            static_cast<int>( to_gram( weight ) / iterations ),
+            static_cast<int>( to_milliliter( volume ) / iterations ) );
+}
@@ -1,11 +1,27 @@
 #include "catch/catch.hpp"
 
 #include "game.h"
+#include "item.h"
 #include "map.h"
+#include "mapbuffer.h"
+#include "map_iterator.h"
 #include "player.h"
+#include "submap.h"
+#include "vehicle.h"
+#include "veh_type.h"
+#include "vpart_position.h"
 
 #include "map_helpers.h"
 
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+
+static size_t buffered_submaps()
+{
+    return std::distance( MAPBUFFER.begin(), MAPBUFFER.end() );
+}
+
 TEST_CASE( "destroy_grabbed_furniture" )
 {
     clear_map();
@@ -25,3 +41,147 @@ TEST_CASE( "destroy_grabbed_furniture" )
         }
     }
 }
+
+TEST_CASE( "vehicle_cache_follows_vehicle" )
+{
+    clear_map();
+    const tripoint origin( 60, 60, 0 );
+    const tripoint shift( 0, 3, 0 );
+    vehicle *veh = g->m.add_vehicle( vproto_id( "bicycle" ), origin, 0, 0, 0 );
+    REQUIRE( veh != nullptr );
+
+    const optional_vpart_position vp = g->m.veh_at( origin );
+    REQUIRE( vp );
+    CHECK( &vp->vehicle() == veh );
+    // Several parts share the tile, the first one is cached
+    CHECK( vp->part_index() == 0 );
+
+    tripoint pos = origin;
+    // Where the parts go after the move, as map::move_vehicle does before displacing it
+    veh->precalc_mounts( 1, veh->face.dir(), veh->pivot_point() );
+    g->m.displace_vehicle( pos, shift );
+    for( const tripoint &p : g->m.points_in_radius( origin, 1 ) ) {
+        CHECK_FALSE( g->m.veh_at( p ) );
+    }
+    const optional_vpart_position moved = g->m.veh_at( origin + shift );
+    REQUIRE( moved );
+    CHECK( &moved->vehicle() == veh );
+
+    g->m.destroy_vehicle( veh );
+    CHECK_FALSE( g->m.veh_at( origin + shift ) );
+}
+
+TEST_CASE( "item_summary_follows_items" )
+{
+    clear_map();
+    const tripoint origin( 60, 60, 0 );
+    for( const tripoint &p : g->m.points_in_radius( origin, SEEX ) ) {
+        g->m.i_clear( p );
+    }
+    CHECK( g->m.item_summary_at( origin ).count == 0 );
+    CHECK_FALSE( g->m.has_items_in_radius( origin, 3 ) );
+
+    g->m.add_item( origin, item( "rock" ) );
+    g->m.add_item( origin, item( "rock" ) );
+    g->m.add_item( origin + tripoint( 1, 0, 0 ), item( "hammer" ) );
+    CHECK( g->m.item_summary_at( origin ).count == 3 );
+    CHECK( g->m.has_items_in_radius( origin + tripoint( 0, SEEY, 0 ), SEEY ) );
+
+    auto stack = g->m.i_at( origin );
+    stack.erase( stack.begin() );
+    CHECK( g->m.item_summary_at( origin ).count == 2 );
+    g->m.i_clear( origin );
+    g->m.i_clear( origin + tripoint( 1, 0, 0 ) );
+    CHECK( g->m.item_summary_at( origin ).count == 0 );
+}
+
+TEST_CASE( "shift_after_load_ahead_needs_no_new_submaps" )
+{
+    // Far away from everything else the tests touch, so nothing there is saved or loaded yet.
+    map here;
+    here.load( 600, 200, 0, false );
+    const size_t loaded = buffered_submaps();
+
+    here.load_ahead( point( 1, 1 ), 1, 100 );
+    const size_t prepared = buffered_submaps();
+    CHECK( prepared > loaded );
+
+    here.shift( 1, 1 );
+    CHECK( buffered_submaps() == prepared );
+    here.load_ahead( point( 1, 1 ), 1, 0 );
+    CHECK( buffered_submaps() == prepared );
+}
+
+// Moves east one submap at a time through land that has not been generated yet, like
+// driving does. The time spent in shifting is what the player notices as stutter.
+TEST_CASE( "driving_map_shift_performance", "[.]" )
+{
+    clear_map();
+    const tripoint center( SEEX * int( MAPSIZE / 2 ) + SEEX / 2, SEEY * int( MAPSIZE / 2 ) + SEEY / 2,
+                           g->get_levz() );
+    for( const bool ahead : {
+             false, true
+         } ) {
+        const int shifts = 40;
+        long shifting = 0;
+        long worst = 0;
+        long preparing = 0;
+        for( int i = 0; i < shifts; i++ ) {
+            if( ahead ) {
+                const auto start = std::chrono::high_resolution_clock::now();
+                // Spread over the turns between two shifts, like game::load_map_ahead does.
+                for( int turn = 0; turn < 4; turn++ ) {
+                    g->m.load_ahead( point( 1, 0 ), 1, 2 );
+                }
+                const auto end = std::chrono::high_resolution_clock::now();
+                preparing += std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+            }
+            g->u.setpos( center + tripoint( SEEX, 0, 0 ) );
+            const auto start = std::chrono::high_resolution_clock::now();
+            g->update_map( g->u );
+            const auto end = std::chrono::high_resolution_clock::now();
+            const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+            shifting += diff;
+            worst = std::max( worst, diff );
+        }
+        printf( "%d shifts %s load ahead: %ld us shifting (worst %ld us), %ld us preparing\n",
+                shifts, ahead ? "with" : "without", shifting, worst, preparing );
+    }
+}
+
+// Lookups done by pathfinding, line of sight and drawing for every tile.
+TEST_CASE( "veh_at_and_move_cost_performance", "[.]" )
+{
+    clear_map();
+    for( int x = 12; x < SEEX * MAPSIZE - 12; x += 6 ) {
+        for( int y = 12; y < SEEY * MAPSIZE - 12; y += 6 ) {
+            g->m.add_vehicle( vproto_id( "bicycle" ), tripoint( x, y, 0 ), 0, 0, 0 );
+        }
+    }
+
+    const int iterations = 20;
+    long found = 0;
+    long cost = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        for( const tripoint &p : g->m.points_in_rectangle( tripoint( 0, 0, 0 ),
+                tripoint( SEEX * MAPSIZE - 1, SEEY * MAPSIZE - 1, 0 ) ) ) {
+            if( g->m.veh_at( p ) ) {
+                found++;
+            }
+        }
+    }
+    const auto mid = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        for( const tripoint &p : g->m.points_in_rectangle( tripoint( 0, 0, 0 ),
+                tripoint( SEEX * MAPSIZE - 1, SEEY * MAPSIZE - 1, 0 ) ) ) {
+            cost += g->m.move_cost( p );
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    CHECK( found > 0 );
+    CHECK( cost > 0 );
+    printf( "veh_at: %ld us, move_cost: %ld us\n",
+            static_cast<long>( std::chrono::duration_cast<std::chrono::microseconds>( mid - start ).count() ),
+            static_cast<long>( std::chrono::duration_cast<std::chrono::microseconds>( end - mid ).count() ) );
+}
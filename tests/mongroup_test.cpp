@@ -0,0 +1,90 @@
+#include "catch/catch.hpp"
+
+#include "mongroup.h"
+#include "options.h"
+#include "overmap.h"
+#include "rng.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+static const mongroup_id GROUP_ZOMBIE( "GROUP_ZOMBIE" );
+
+TEST_CASE( "mongroup_map_buckets_groups_by_position" )
+{
+    mongroup_map groups;
+    mongroup &moving = groups.insert( mongroup( GROUP_ZOMBIE, 5, 5, 0, 1, 10 ) );
+    groups.insert( mongroup( GROUP_ZOMBIE, 5, 5, 0, 1, 20 ) );
+    groups.insert( mongroup( GROUP_ZOMBIE, -1, -1, 0, 1, 30 ) );
+    groups.insert( mongroup( GROUP_ZOMBIE, 100, 100, 0, 1, 40 ) );
+    REQUIRE( groups.size() == 4 );
+    CHECK( groups.groups_at( tripoint( 5, 5, 0 ) ).size() == 2 );
+    CHECK( groups.groups_at( tripoint( -1, -1, 0 ) ).size() == 1 );
+    CHECK( groups.groups_at( tripoint( 5, 5, 1 ) ).empty() );
+
+    SECTION( "moved groups keep their identity" ) {
+        groups.move( moving, tripoint( 50, 5, 0 ) );
+        CHECK( moving.pos == tripoint( 50, 5, 0 ) );
+        CHECK( moving.population == 10 );
+        const std::vector<mongroup *> at = groups.groups_at( tripoint( 50, 5, 0 ) );
+        REQUIRE( at.size() == 1 );
+        CHECK( at[0] == &moving );
+        CHECK( groups.groups_at( tripoint( 5, 5, 0 ) ).size() == 1 );
+        CHECK( groups.size() == 4 );
+    }
+
+    SECTION( "nearby groups are found" ) {
+        const std::vector<mongroup *> near = groups.groups_near( tripoint( 2, 2, 0 ), 4 );
+        CHECK( near.size() == 3 );
+        CHECK( groups.groups_near( tripoint( 100, 100, 0 ), 0 ).size() == 1 );
+    }
+
+    SECTION( "erasing while iterating" ) {
+        int visited = 0;
+        for( auto it = groups.begin(); it != groups.end(); ) {
+            visited++;
+            if( it->population != 40 ) {
+                it = groups.erase( it );
+            } else {
+                ++it;
+            }
+        }
+        CHECK( visited == 4 );
+        REQUIRE( groups.size() == 1 );
+        CHECK( groups.begin()->population == 40 );
+    }
+}
+
+// A week of horde movement, and a signal (like a loud noise) each time, on a 3x3 region
+// of overmaps.
+TEST_CASE( "horde_movement_performance", "[.]" )
+{
+    options_manager::cOpt &wander_spawns = get_options().get_option( "WANDER_SPAWNS" );
+    const std::string old_value = wander_spawns.getValue();
+    wander_spawns.setValue( "true" );
+
+    std::vector<std::unique_ptr<overmap>> region;
+    for( int x = 30; x < 33; x++ ) {
+        for( int y = 30; y < 33; y++ ) {
+            region.emplace_back( new overmap( x, y ) );
+            region.back()->populate();
+        }
+    }
+    wander_spawns.setValue( old_value );
+
+    const int steps = 7 * 24 * 12;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < steps; i++ ) {
+        for( auto &om : region ) {
+            om->move_hordes();
+            om->signal_hordes( tripoint( rng( 0, OMAPX * 2 - 1 ), rng( 0, OMAPY * 2 - 1 ), 0 ),
+                               rng( 10, 60 ) );
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d horde movement steps on %d overmaps took %ld us\n", steps,
+            static_cast<int>( region.size() ), diff );
+}
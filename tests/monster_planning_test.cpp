@@ -0,0 +1,89 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "monster.h"
+#include "player.h"
+#include "rng.h"
+#include "thread_pool.h"
+#include "world_snapshot.h"
+
+#include "map_helpers.h"
+#include "options_helpers.h"
+#include "player_helpers.h"
+
+#include <cstdlib>
+#include <vector>
+
+static std::vector<monster_intent> plan_all( const int thread_count )
+{
+    const worker_threads_scope threads( thread_count );
+    const rng_seed_scope seeded_rng( 4321 );
+    const world_snapshot world;
+    std::vector<monster_intent> intents( world.monsters.size() );
+    parallel_for_seeded( 0, static_cast<int>( intents.size() ), [&]( const int i ) {
+        intents[i] = static_cast<const monster *>( world.monsters[i].who )->plan_intent( world );
+    } );
+    return intents;
+}
+
+TEST_CASE( "monster_plans_do_not_depend_on_thread_count" )
+{
+    clear_map();
+    clear_player();
+    const tripoint center = g->u.pos();
+    monster &adjacent = spawn_test_monster( "mon_zombie", center + tripoint( 1, 0, 0 ) );
+    for( int x = -12; x <= 12; x += 3 ) {
+        for( int y = -12; y <= 12; y += 4 ) {
+            if( std::abs( x ) > 1 || std::abs( y ) > 1 ) {
+                spawn_test_monster( "mon_zombie", center + tripoint( x, y, 0 ) );
+            }
+        }
+    }
+    for( int i = 0; i < 4; i++ ) {
+        monster &dog = spawn_test_monster( "mon_dog", center + tripoint( -2 - i, 3, 0 ) );
+        dog.friendly = -1;
+    }
+    std::vector<monster *> monsters;
+    for( monster &critter : g->all_monsters() ) {
+        monsters.push_back( &critter );
+    }
+
+    const std::vector<monster_intent> serial = plan_all( 1 );
+    REQUIRE( serial.size() == monsters.size() );
+    CHECK( plan_all( 4 ) == serial );
+    for( size_t i = 0; i < monsters.size(); i++ ) {
+        if( monsters[i] == &adjacent ) {
+            REQUIRE( serial[i].dest );
+            CHECK( *serial[i].dest == center );
+        }
+    }
+
+    SECTION( "plans come from the snapshot and not the live creatures" ) {
+        const world_snapshot world;
+        const tripoint moved = center + tripoint( 0, 2, 0 );
+        g->u.setpos( moved );
+        REQUIRE( world.u.pos == center );
+        const monster_intent intent = adjacent.plan_intent( world );
+        REQUIRE( intent.dest );
+        CHECK( *intent.dest == center );
+        g->u.setpos( center );
+    }
+
+    SECTION( "monsters move with parallel planning disabled" ) {
+        const option_override parallel( "PARALLEL_MONSTER_PLANNING", "false" );
+        adjacent.moves = 100;
+        g->monmove();
+        CHECK( adjacent.move_target() == center );
+        CHECK( adjacent.moves <= 0 );
+    }
+
+    SECTION( "monsters move with parallel planning enabled" ) {
+        const option_override parallel( "PARALLEL_MONSTER_PLANNING", "true" );
+        adjacent.moves = 100;
+        g->monmove();
+        CHECK( adjacent.move_target() == center );
+        CHECK( adjacent.moves <= 0 );
+    }
+
+    clear_map();
+}
@@ -6,9 +6,23 @@
 #include "npc_class.h"
 #include "game.h"
 #include "map.h"
+#include "map_iterator.h"
+#include "mapdata.h"
+#include "monster.h"
+#include "overmapbuffer.h"
+#include "rng.h"
 #include "text_snippets.h"
+#include "thread_pool.h"
 
+#include "map_helpers.h"
+#include "options_helpers.h"
+#include "player_helpers.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 
 void on_load_test( npc &who, const time_duration &from, const time_duration &to )
 {
@@ -184,3 +198,168 @@ TEST_CASE( "snippet-tag-test" )
     CHECK( SNIPPET.all_ids_from_category( "<mywp>" ).empty() );
     CHECK( SNIPPET.all_ids_from_category( "<ammo>" ).empty() );
 }
+
+struct npc_plan {
+    const Creature *target;
+    float danger;
+
+    bool operator==( const npc_plan &rhs ) const {
+        return target == rhs.target && danger == rhs.danger;
+    }
+};
+
+static std::vector<npc_plan> plan_npcs( const std::vector<npc *> &npcs, const int thread_count )
+{
+    const worker_threads_scope threads( thread_count );
+    const rng_seed_scope seeded_rng( 2468 );
+    parallel_for_seeded( 0, static_cast<int>( npcs.size() ), [&]( const int i ) {
+        npcs[i]->regen_ai_cache();
+    } );
+    std::vector<npc_plan> result;
+    for( npc *guy : npcs ) {
+        result.push_back( { guy->current_target(), guy->danger_assessment() } );
+    }
+    return result;
+}
+
+TEST_CASE( "npc_plans_do_not_depend_on_thread_count" )
+{
+    clear_map();
+    clear_player();
+    const tripoint center = g->u.pos();
+    std::vector<int> ids;
+    {
+        const rng_seed_scope seeded_rng( 1357 );
+        for( int i = 0; i < 6; i++ ) {
+            std::shared_ptr<npc> guy = std::make_shared<npc>();
+            guy->normalize();
+            guy->randomize();
+            // Keep them from walking up to the player to talk or mug
+            guy->set_attitude( NPCATT_NULL );
+            guy->mission = NPC_MISSION_SHELTER;
+            guy->spawn_at_precise( { g->get_levx(), g->get_levy() },
+                                   center + tripoint( -6 + 2 * i, 5, 0 ) );
+            overmap_buffer.insert_npc( guy );
+            ids.push_back( guy->getID() );
+        }
+    }
+    g->load_npcs();
+    for( int x = -10; x <= 10; x += 4 ) {
+        spawn_test_monster( "mon_zombie", center + tripoint( x, 8, 0 ) );
+    }
+    std::vector<npc *> npcs;
+    for( npc &guy : g->all_npcs() ) {
+        npcs.push_back( &guy );
+    }
+    REQUIRE( npcs.size() == ids.size() );
+
+    const std::vector<npc_plan> serial = plan_npcs( npcs, 1 );
+    CHECK( plan_npcs( npcs, 4 ) == serial );
+    for( npc *guy : npcs ) {
+        guy->regen_ai_cache();
+    }
+    CHECK( plan_npcs( npcs, 1 ) == serial );
+
+    SECTION( "npcs act on the targets picked in parallel" ) {
+        const option_override parallel( "PARALLEL_NPC_PLANNING", "true" );
+        for( npc *guy : npcs ) {
+            guy->moves = 100;
+        }
+        g->monmove();
+        for( npc *guy : npcs ) {
+            CHECK( guy->moves <= 0 );
+        }
+    }
+
+    g->unload_npcs();
+    for( const int id : ids ) {
+        overmap_buffer.remove_npc( id );
+    }
+    clear_map();
+}
+
+TEST_CASE( "npcs_drop_targets_killed_by_earlier_npcs" )
+{
+    clear_map();
+    clear_player();
+    const tripoint center = g->u.pos();
+    std::vector<int> ids;
+    for( int i = 0; i < 2; i++ ) {
+        std::shared_ptr<npc> guy = std::make_shared<npc>();
+        guy->normalize();
+        guy->randomize();
+        guy->set_attitude( NPCATT_NULL );
+        guy->mission = NPC_MISSION_SHELTER;
+        guy->spawn_at_precise( { g->get_levx(), g->get_levy() }, center + tripoint( 3 * i, 5, 0 ) );
+        overmap_buffer.insert_npc( guy );
+        ids.push_back( guy->getID() );
+    }
+    g->load_npcs();
+    std::vector<npc *> npcs;
+    for( npc &guy : g->all_npcs() ) {
+        npcs.push_back( &guy );
+    }
+    REQUIRE( npcs.size() == 2 );
+    npc &killer = *npcs[0];
+    npc &later = *npcs[1];
+    monster &zombie = spawn_test_monster( "mon_zombie", later.pos() + tripoint( 1, 0, 0 ) );
+
+    // Like game::monmove does with parallel planning, before any of them acts
+    killer.regen_ai_cache();
+    later.regen_ai_cache();
+    REQUIRE( later.current_target() == &zombie );
+    REQUIRE( later.ai_cache_valid() );
+
+    zombie.die( &killer );
+    CHECK_FALSE( later.ai_cache_valid() );
+    later.moves = 100;
+    later.move_with_ai_cache();
+    CHECK( later.current_target() != &zombie );
+
+    g->unload_npcs();
+    for( const int id : ids ) {
+        overmap_buffer.remove_npc( id );
+    }
+    clear_map();
+}
+
+// A looted mall: long rows of empty shelves, with some junk left behind on the floor.
+TEST_CASE( "npc_scavenging_performance", "[.]" )
+{
+    clear_map();
+    clear_player();
+    const tripoint center = g->u.pos();
+    const std::vector<std::string> junk = { "rock", "paper", "can_drink_unsealed", "stick", "nail" };
+    for( const tripoint &p : g->m.points_in_radius( center, 30 ) ) {
+        g->m.i_clear( p );
+        g->m.ter_set( p, t_floor );
+        if( ( p.x - center.x ) % 4 == 0 && p.y != center.y ) {
+            g->m.furn_set( p, furn_str_id( "f_rack" ) );
+        } else if( one_in( 6 ) ) {
+            g->m.add_item( p, item( random_entry( junk ) ) );
+        }
+    }
+    g->m.build_map_cache( 0, true );
+
+    std::vector<std::shared_ptr<npc>> npcs;
+    for( int i = 0; i < 20; i++ ) {
+        std::shared_ptr<npc> guy = std::make_shared<npc>();
+        guy->normalize();
+        guy->randomize();
+        guy->setpos( center + tripoint( -19 + 2 * i, 1, 0 ) );
+        npcs.push_back( guy );
+    }
+
+    const int turns = 50;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int turn = 0; turn < turns; turn++ ) {
+        for( const std::shared_ptr<npc> &guy : npcs ) {
+            guy->find_item();
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d turns of %d npcs looking for items took %ld us\n", turns,
+            static_cast<int>( npcs.size() ), diff );
+    clear_map();
+}
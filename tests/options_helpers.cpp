@@ -0,0 +1,19 @@
+#include "options_helpers.h"
+
+#include "options.h"
+
+option_override::option_override( const std::string &name, const std::string &value ) :
+    name( name ), old_value( get_options().get_option( name ).getValue() )
+{
+    get_options().get_option( name ).setValue( value );
+}
+
+option_override::~option_override()
+{
+    get_options().get_option( name ).setValue( old_value );
+}
+
+worker_threads_scope::worker_threads_scope( const int count ) :
+    option( "WORKER_THREADS", std::to_string( count ) )
+{
+}
@@ -0,0 +1,27 @@
+#pragma once
+#ifndef OPTIONS_HELPERS_H
+#define OPTIONS_HELPERS_H
+
+#include <string>
+
+// Sets an option for the duration of a test.
+class option_override
+{
+    public:
+        option_override( const std::string &name, const std::string &value );
+        ~option_override();
+    private:
+        std::string name;
+        std::string old_value;
+};
+
+// Sets the number of worker threads for the duration of a test.
+class worker_threads_scope
+{
+    public:
+        worker_threads_scope( int count );
+    private:
+        option_override option;
+};
+
+#endif
@@ -0,0 +1,20 @@
+#include "catch/catch.hpp"
+
+#include "options.h"
+
+TEST_CASE( "option_handle_follows_option_value" )
+{
+    auto &opt = get_options().get_option( "AUTOSAVE_TURNS" );
+    const int old_value = opt.value_as<int>();
+    const option_handle<int> handle( "AUTOSAVE_TURNS" );
+
+    CHECK( handle.value() == get_option<int>( "AUTOSAVE_TURNS" ) );
+
+    opt.setValue( old_value + 1 );
+    CHECK( handle.value() == old_value + 1 );
+
+    get_options().invalidate_handles();
+    opt.setValue( old_value );
+    CHECK( handle.value() == old_value );
+    CHECK( handle.value() == get_option<int>( "AUTOSAVE_TURNS" ) );
+}
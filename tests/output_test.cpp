@@ -0,0 +1,96 @@
+#include "catch/catch.hpp"
+
+#include "compatibility.h"
+#include "cursesdef.h"
+#include "item.h"
+#include "output.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+TEST_CASE( "folded_text_is_split_into_color_runs" )
+{
+    clear_colored_text_cache();
+    const std::string text = "<color_red>red</color> and plain, <color_light_green>green";
+    const auto folded = fold_colored_text( text, 0 );
+    REQUIRE( folded->lines == std::vector<std::string> { text } );
+    REQUIRE( folded->runs.size() == 1 );
+    const std::vector<color_run> &runs = folded->runs.front();
+    REQUIRE( runs.size() == 3 );
+    CHECK( runs[0].tag == color_run::tag_type::color );
+    CHECK( runs[0].color == c_red );
+    CHECK( runs[0].text == "red" );
+    CHECK( runs[1].tag == color_run::tag_type::base );
+    CHECK( runs[1].text == " and plain, " );
+    CHECK( runs[2].tag == color_run::tag_type::color );
+    CHECK( runs[2].color == c_light_green );
+    CHECK( runs[2].text == "green" );
+
+    const std::vector<std::string> lines = foldstring( text, 10 );
+    CHECK( lines.size() > 1 );
+    CHECK( fold_colored_text( text, 10 )->runs.size() == lines.size() );
+    CHECK( fold_colored_text( text, 0 ) == folded );
+
+    SECTION( "results are kept until they are least recently used" ) {
+        for( int i = 0; i < 5000; i++ ) {
+            fold_colored_text( text, 0 );
+            fold_colored_text( "line " + to_string( i ), 0 );
+        }
+        CHECK( fold_colored_text( text, 0 ) == folded );
+        CHECK( fold_colored_text( "line 0", 0 )->lines.front() == "line 0" );
+        CHECK( foldstring( text, 10 ) == lines );
+    }
+
+    SECTION( "clearing drops the results" ) {
+        clear_colored_text_cache();
+        CHECK( fold_colored_text( text, 0 ) != folded );
+        CHECK( foldstring( text, 10 ) == lines );
+    }
+}
+
+static long time_item_screens( const std::vector<item> &items, const int frames,
+                               const bool cached )
+{
+    // Printing into no window at all, so this only measures preparing the text
+    const catacurses::window w;
+    std::vector<std::string> infos;
+    std::vector<std::string> names;
+    for( const item &it : items ) {
+        infos.push_back( it.info( true ) );
+        names.push_back( it.display_name() );
+    }
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int frame = 0; frame < frames; frame++ ) {
+        for( size_t i = 0; i < names.size(); i++ ) {
+            if( !cached ) {
+                clear_colored_text_cache();
+            }
+            nc_color color = c_white;
+            print_colored_text( w, i, 0, color, c_white, names[i] );
+        }
+        if( !cached ) {
+            clear_colored_text_cache();
+        }
+        fold_and_print_from( w, 0, 0, 50, 0, c_light_gray, infos[frame % infos.size()] );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+}
+
+TEST_CASE( "item_screen_text_performance", "[.]" )
+{
+    std::vector<item> items;
+    for( const char *id : {
+             "rock", "backpack", "hammer", "katana", "knife_combat", "halberd", "aspirin",
+             "water_clean", "glock_19", "sw_619", "brewing_cookbook", "metal_tank"
+         } ) {
+        items.emplace_back( id );
+    }
+    const int frames = 1000;
+    const long uncached = time_item_screens( items, frames, false );
+    const long cached = time_item_screens( items, frames, true );
+    printf( "%d frames of inventory and item info text took %ld us parsing every time, "
+            "%ld us with cached parsing\n", frames, uncached, cached );
+}
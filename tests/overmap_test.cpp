@@ -1,9 +1,33 @@
 #include "catch/catch.hpp"
 
+#include "line.h"
 #include "map.h"
+#include "omdata.h"
 #include "overmap.h"
 #include "overmapbuffer.h"
 
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+// The expanding box that overmapbuffer::find_closest used to search with, for comparison.
+static tripoint find_closest_by_scanning( const tripoint &origin, const std::string &type,
+        const int max )
+{
+    for( int dist = 1; dist <= max; dist++ ) {
+        for( int x = origin.x - dist; x <= origin.x + dist; x++ ) {
+            for( int y = origin.y - dist; y <= origin.y + dist; y++ ) {
+                if( square_dist( origin.x, origin.y, x, y ) == dist &&
+                    overmap_buffer.check_ot_type( type, x, y, origin.z ) ) {
+                    return tripoint( x, y, origin.z );
+                }
+            }
+        }
+    }
+    return overmap::invalid_tripoint;
+}
+
 TEST_CASE( "set_and_get_overmap_scents" )
 {
     std::unique_ptr<overmap> test_overmap = std::unique_ptr<overmap>( new overmap( 0, 0 ) );
@@ -45,3 +69,124 @@ TEST_CASE( "default_overmap_generation_always_succeeds" )
         }
     }
 }
+
+static std::array<bool, 4> existing_neighbors( const point &pos )
+{
+    return {{
+            overmap_buffer.has( pos.x, pos.y - 1 ), overmap_buffer.has( pos.x + 1, pos.y ),
+            overmap_buffer.has( pos.x, pos.y + 1 ), overmap_buffer.has( pos.x - 1, pos.y )
+        }
+    };
+}
+
+// Returns false when the position can't be used: generating the reference synchronously
+// creates a neighbouring overmap when mandatory specials don't fit, the background result
+// is dropped then.
+static bool check_pregenerated_overmap( const point &pos )
+{
+    if( overmap_buffer.has( pos.x, pos.y ) ) {
+        return false;
+    }
+    const std::array<bool, 4> neighbors = existing_neighbors( pos );
+    overmap reference( pos.x, pos.y );
+    reference.populate();
+    if( existing_neighbors( pos ) != neighbors ) {
+        return false;
+    }
+    std::ostringstream expected;
+    reference.serialize( expected );
+
+    overmap_buffer.pregenerate( pos );
+    std::ostringstream actual;
+    overmap_buffer.get( pos.x, pos.y ).serialize( actual );
+    CHECK( actual.str() == expected.str() );
+    return true;
+}
+
+TEST_CASE( "pregenerated_overmap_matches_synchronous_generation" )
+{
+    SECTION( "without neighbours" ) {
+        for( const point pos : { point( 40, 40 ), point( 44, 40 ), point( 48, 40 ) } ) {
+            if( check_pregenerated_overmap( pos ) ) {
+                return;
+            }
+        }
+        FAIL( "no overmap could be generated without neighbours" );
+    }
+    SECTION( "next to existing overmaps" ) {
+        // Rivers and roads continue from the neighbours to the north and west
+        for( const point pos : { point( 40, 50 ), point( 44, 50 ), point( 48, 50 ) } ) {
+            overmap_buffer.get( pos.x, pos.y - 1 );
+            overmap_buffer.get( pos.x - 1, pos.y );
+            if( check_pregenerated_overmap( pos ) ) {
+                return;
+            }
+        }
+        FAIL( "no overmap could be generated next to existing ones" );
+    }
+}
+
+TEST_CASE( "find_closest_and_find_all_use_the_terrain_index" )
+{
+    const tripoint origin( 90, 90, 0 );
+    const int radius = 40;
+
+    for( const std::string type : {
+             "house", "s_gas", "road", "field"
+         } ) {
+        CAPTURE( type );
+        const tripoint scanned = find_closest_by_scanning( origin, type, radius );
+        const tripoint closest = overmap_buffer.find_closest( origin, type, radius, false );
+        REQUIRE( ( scanned == overmap::invalid_tripoint ) == ( closest == overmap::invalid_tripoint ) );
+        if( closest != overmap::invalid_tripoint ) {
+            CHECK( overmap_buffer.check_ot_type( type, closest.x, closest.y, closest.z ) );
+            CHECK( square_dist( origin, closest ) == square_dist( origin, scanned ) );
+        }
+
+        std::vector<tripoint> expected;
+        for( int x = origin.x - radius; x <= origin.x + radius; x++ ) {
+            for( int y = origin.y - radius; y <= origin.y + radius; y++ ) {
+                if( overmap_buffer.check_ot_type( type, x, y, origin.z ) ) {
+                    expected.emplace_back( x, y, origin.z );
+                }
+            }
+        }
+        CHECK( overmap_buffer.find_all( origin, type, radius, false ) == expected );
+    }
+
+    SECTION( "changed terrain is found" ) {
+        const tripoint changed = origin + tripoint( 1, 0, 0 );
+        const oter_id before = overmap_buffer.ter( changed );
+        overmap_buffer.ter( changed ) = oter_id( "s_gas_north" );
+        const tripoint found = overmap_buffer.find_closest( origin, "s_gas", radius, false );
+        CHECK( square_dist( origin, found ) == 1 );
+        overmap_buffer.ter( changed ) = before;
+        CHECK( overmap_buffer.find_closest( origin, "s_gas", radius, false ) != changed );
+    }
+}
+
+TEST_CASE( "find_closest_performance", "[.]" )
+{
+    const tripoint origin( 90, 90, 0 );
+    const int iterations = 20;
+    for( const std::string type : {
+             "house", "s_gas", "hospital"
+         } ) {
+        // Creates the overmaps, so neither measurement includes generating them.
+        const tripoint expected = overmap_buffer.find_closest( origin, type, 0, false );
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        for( int i = 0; i < iterations; i++ ) {
+            find_closest_by_scanning( origin, type, OMAPX * 5 );
+        }
+        const auto mid = std::chrono::high_resolution_clock::now();
+        for( int i = 0; i < iterations; i++ ) {
+            CHECK( overmap_buffer.find_closest( origin, type, 0, false ) == expected );
+        }
+        const auto end = std::chrono::high_resolution_clock::now();
+        printf( "%d searches for the closest %s: scanning %ld us, indexed %ld us\n", iterations,
+                type.c_str(),
+                static_cast<long>( std::chrono::duration_cast<std::chrono::microseconds>( mid - start ).count() ),
+                static_cast<long>( std::chrono::duration_cast<std::chrono::microseconds>( end - mid ).count() ) );
+    }
+}
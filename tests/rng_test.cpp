@@ -0,0 +1,72 @@
+#include "catch/catch.hpp"
+
+#include "rng.h"
+
+#include <vector>
+
+static std::vector<long> draw_some()
+{
+    std::vector<long> result;
+    for( int i = 0; i < 100; i++ ) {
+        result.push_back( rng( 0, 1000000 ) );
+    }
+    return result;
+}
+
+TEST_CASE( "rng_stream_state_can_be_restored" )
+{
+    rng_stream &stream = rng_default_stream();
+    const rng_stream::state_type saved = stream.state();
+    const std::vector<long> first = draw_some();
+    CHECK( draw_some() != first );
+
+    stream.set_state( saved );
+    CHECK( draw_some() == first );
+}
+
+TEST_CASE( "rng_seed_scope_uses_its_own_stream" )
+{
+    const std::vector<long> seeded = [] {
+        const rng_seed_scope scope( 42 );
+        return draw_some();
+    }();
+
+    const rng_stream::state_type outside = rng_default_stream().state();
+    {
+        const rng_seed_scope scope( 42 );
+        CHECK( draw_some() == seeded );
+    }
+    CHECK( rng_default_stream().state() == outside );
+
+    SECTION( "a stream kept by its owner continues where it left off" ) {
+        rng_stream kept( 42 );
+        {
+            const rng_seed_scope scope( kept );
+            draw_some();
+        }
+        const rng_seed_scope scope( kept );
+        CHECK( draw_some() != seeded );
+    }
+}
+
+TEST_CASE( "rng_stays_in_range" )
+{
+    const rng_seed_scope scope( 7 );
+    bool saw_min = false;
+    bool saw_max = false;
+    for( int i = 0; i < 1000; i++ ) {
+        const long value = rng( -3, 3 );
+        REQUIRE( value >= -3 );
+        REQUIRE( value <= 3 );
+        saw_min = saw_min || value == -3;
+        saw_max = saw_max || value == 3;
+
+        const double fvalue = rng_float( 0.5, 1.5 );
+        REQUIRE( fvalue >= 0.5 );
+        REQUIRE( fvalue < 1.5 );
+    }
+    CHECK( saw_min );
+    CHECK( saw_max );
+    CHECK( x_in_y( 1, 1 ) );
+    CHECK_FALSE( x_in_y( 0, 1 ) );
+}
@@ -0,0 +1,108 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "line.h"
+#include "monster.h"
+#include "rng.h"
+#include "sounds.h"
+#include "weather.h"
+
+#include "map_helpers.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+TEST_CASE( "monsters_hear_sounds_in_range" )
+{
+    clear_map();
+    std::vector<monster *> monsters;
+    for( int x = 2; x < MAPSIZE * SEEX; x += 5 ) {
+        for( int y = 2; y < MAPSIZE * SEEY; y += 5 ) {
+            monsters.push_back( &spawn_test_monster( "mon_zombie", tripoint( x, y, 0 ) ) );
+        }
+    }
+
+    const std::vector<std::pair<tripoint, int>> test_sounds = { {
+            { tripoint( 60, 60, 0 ), 30 },
+            { tripoint( 5, 5, 0 ), 20 },
+            { tripoint( 130, 10, 0 ), 45 },
+            { tripoint( 40, 100, 0 ), 8 },
+            { tripoint( 70, 70, 0 ), 0 },
+        }
+    };
+    for( const auto &test_sound : test_sounds ) {
+        for( monster *critter : monsters ) {
+            critter->wandf = 0;
+        }
+        sounds::reset_sounds();
+        sounds::sound( test_sound.first, test_sound.second, "" );
+        sounds::process_sounds();
+
+        const int vol = test_sound.second - weather_data( g->weather ).sound_attn;
+        for( const monster *critter : monsters ) {
+            const int dist = rl_dist( test_sound.first, critter->pos() );
+            INFO( "sound at " << test_sound.first << " volume " << vol << ", monster at " <<
+                  critter->pos() );
+            // Zombies don't have good hearing, so they hear a sound up to its volume away
+            CHECK( ( critter->wandf > 0 ) == ( dist < vol ) );
+        }
+    }
+
+    clear_map();
+}
+
+TEST_CASE( "sounds_in_one_submap_are_clustered" )
+{
+    sounds::reset_sounds();
+    sounds::sound( tripoint( 2, 10, 0 ), 10, "" );
+    sounds::sound( tripoint( 50, 50, 0 ), 5, "" );
+    sounds::sound( tripoint( 6, 10, 0 ), 30, "" );
+    sounds::sound( tripoint( 52, 50, 0 ), 0, "" );
+    sounds::sound( tripoint( 10, 10, 1 ), 0, "" );
+
+    const std::vector<tripoint> clusters = sounds::get_monster_sounds().second;
+    const std::vector<tripoint> expected = { {
+            tripoint( 5, 10, 0 ), tripoint( 50, 50, 0 ), tripoint( 10, 10, 1 )
+        }
+    };
+    CHECK( clusters == expected );
+    CHECK( sounds::get_monster_sounds().second == clusters );
+    sounds::reset_sounds();
+}
+
+TEST_CASE( "sounds_all_over_the_map_make_few_clusters" )
+{
+    sounds::reset_sounds();
+    for( int x = 0; x < MAPSIZE; x++ ) {
+        for( int y = 0; y < MAPSIZE; y++ ) {
+            sounds::sound( tripoint( x * SEEX + 5, y * SEEY + 5, 0 ), 10, "" );
+        }
+    }
+    const std::vector<tripoint> clusters = sounds::get_monster_sounds().second;
+    CHECK( clusters.size() > 1 );
+    CHECK( clusters.size() <= 10 );
+    sounds::reset_sounds();
+}
+
+TEST_CASE( "sound_clustering_performance", "[.]" )
+{
+    clear_map();
+    for( const int count : { 1000, 10000 } ) {
+        const int turns = 100;
+        long diff = 0;
+        for( int turn = 0; turn < turns; turn++ ) {
+            sounds::reset_sounds();
+            for( int i = 0; i < count; i++ ) {
+                sounds::sound( tripoint( rng( 0, MAPSIZE * SEEX - 1 ), rng( 0, MAPSIZE * SEEY - 1 ), 0 ),
+                               rng( 1, 50 ), "" );
+            }
+            const auto start = std::chrono::high_resolution_clock::now();
+            sounds::process_sounds();
+            const auto end = std::chrono::high_resolution_clock::now();
+            diff += std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+        }
+        printf( "%d turns of processing %d sounds took %ld us\n", turns, count, diff );
+    }
+    sounds::reset_sounds();
+}
@@ -0,0 +1,82 @@
+#include "catch/catch.hpp"
+
+#include "calendar.h"
+#include "game.h"
+#include "player.h"
+#include "player_helpers.h"
+#include "string_id.h"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+namespace
+{
+struct test_type_a;
+struct test_type_b;
+} // namespace
+
+TEST_CASE( "string_id_interning" )
+{
+    const string_id<test_type_a> a1( "some_id" );
+    const string_id<test_type_a> a2( std::string( "some_" ) + "id" );
+    const string_id<test_type_a> other( "some_other_id" );
+    const string_id<test_type_b> b( "some_id" );
+
+    CHECK( a1 == a2 );
+    CHECK( a1 != other );
+    CHECK( a1.symbol() == a2.symbol() );
+    CHECK( a1.symbol() == b.symbol() );
+    CHECK( a1.symbol() != other.symbol() );
+    CHECK( std::hash<string_id<test_type_a>>()( a1 ) == std::hash<string_id<test_type_a>>()( a2 ) );
+    CHECK( a1.str() == "some_id" );
+    CHECK( a1 == "some_id" );
+
+    // ordering stays alphabetical
+    CHECK( a1 < other );
+    CHECK_FALSE( other < a1 );
+    CHECK_FALSE( a1 < a2 );
+
+    CHECK( string_id<test_type_a>().is_empty() );
+    CHECK( string_id<test_type_a>( "" ) == string_id<test_type_a>() );
+    CHECK_FALSE( a1.is_empty() );
+}
+
+TEST_CASE( "has_effect_and_has_trait_performance", "[.]" )
+{
+    clear_player();
+    player &dummy = g->u;
+    const std::vector<efftype_id> effects = {
+        efftype_id( "downed" ), efftype_id( "stunned" ), efftype_id( "blind" ),
+        efftype_id( "deaf" ), efftype_id( "winded" ), efftype_id( "onfire" )
+    };
+    const std::vector<trait_id> traits = {
+        trait_id( "FLEET" ), trait_id( "NIGHTVISION" ), trait_id( "LIGHTWEIGHT" ),
+        trait_id( "PARKOUR" ), trait_id( "SLOWLEARNER" )
+    };
+    for( size_t i = 0; i < effects.size(); i += 2 ) {
+        dummy.add_effect( effects[i], 1_hours );
+    }
+    for( size_t i = 0; i < traits.size(); i += 2 ) {
+        dummy.set_mutation( traits[i] );
+    }
+
+    const int iterations = 100000;
+    int found = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < iterations; i++ ) {
+        for( const efftype_id &eff : effects ) {
+            found += dummy.has_effect( eff );
+        }
+        for( const trait_id &tr : traits ) {
+            found += dummy.has_trait( tr );
+        }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d rounds of has_effect/has_trait took %ld us (%d found)\n", iterations, diff, found );
+
+    dummy.clear_effects();
+    clear_player();
+}
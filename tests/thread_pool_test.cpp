@@ -0,0 +1,162 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "map.h"
+#include "mapdata.h"
+#include "rng.h"
+#include "thread_pool.h"
+
+#include "map_helpers.h"
+#include "options_helpers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "parallel_for_visits_each_index_once" )
+{
+    const worker_threads_scope threads( 4 );
+    REQUIRE( parallel_thread_count() == 4 );
+
+    std::vector<int> visited( 1000, 0 );
+    parallel_for( 0, static_cast<int>( visited.size() ), [&]( const int i ) {
+        visited[i]++;
+    }, 7 );
+    CHECK( std::count( visited.begin(), visited.end(), 1 ) == 1000 );
+
+    SECTION( "nested calls" ) {
+        std::atomic<int> total( 0 );
+        parallel_for( 0, 10, [&]( const int ) {
+            parallel_for( 0, 10, [&]( const int ) {
+                total++;
+            } );
+        } );
+        CHECK( total == 100 );
+    }
+
+    SECTION( "task groups" ) {
+        std::atomic<int> total( 0 );
+        task_group group;
+        for( int i = 1; i <= 10; i++ ) {
+            group.run( [&total, i]() {
+                total += i;
+            } );
+        }
+        group.wait();
+        CHECK( total == 55 );
+    }
+}
+
+TEST_CASE( "parallel_for_does_not_wait_for_background_tasks" )
+{
+    const worker_threads_scope threads( 2 );
+    REQUIRE( parallel_thread_count() == 2 );
+
+    // Keeps the only worker busy, like a slow submap read would
+    std::atomic<bool> started( false );
+    std::atomic<bool> release( false );
+    std::atomic<bool> finished( false );
+    run_in_background( [&]() {
+        started = true;
+        while( !release ) {
+            std::this_thread::yield();
+        }
+        finished = true;
+    } );
+    while( !started ) {
+        std::this_thread::yield();
+    }
+
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<int> visited( 100, 0 );
+    bool all_on_caller = true;
+    parallel_for( 0, static_cast<int>( visited.size() ), [&]( const int i ) {
+        visited[i]++;
+        all_on_caller = all_on_caller && std::this_thread::get_id() == caller;
+    } );
+    CHECK( std::count( visited.begin(), visited.end(), 1 ) == 100 );
+    CHECK( all_on_caller );
+    CHECK_FALSE( finished );
+
+    release = true;
+    while( !finished ) {
+        std::this_thread::yield();
+    }
+}
+
+TEST_CASE( "parallel_for_seeded_is_independent_of_thread_count" )
+{
+    const auto draw = []( const int thread_count ) {
+        const worker_threads_scope threads( thread_count );
+        const rng_seed_scope seeded_rng( 1234 );
+        std::vector<int> results( 100, 0 );
+        parallel_for_seeded( 0, static_cast<int>( results.size() ), [&]( const int i ) {
+            results[i] = rng( 0, 1000000 );
+        } );
+        return results;
+    };
+    const std::vector<int> serial = draw( 1 );
+    CHECK( draw( 1 ) == serial );
+    CHECK( draw( 4 ) == serial );
+}
+
+TEST_CASE( "map_caches_do_not_depend_on_thread_count" )
+{
+    clear_map();
+    const int mapsize = g->m.getmapsize() * SEEX;
+    for( int x = 0; x < mapsize; x += 5 ) {
+        for( int y = 0; y < mapsize; y += 7 ) {
+            g->m.ter_set( x, y, t_floor );
+        }
+    }
+    g->m.ter_set( mapsize - 1, mapsize - 1, t_floor );
+
+    const auto build = []( const int thread_count ) {
+        const worker_threads_scope threads( thread_count );
+        g->m.set_outside_cache_dirty( 0 );
+        g->m.set_floor_cache_dirty( 0 );
+        g->m.build_map_cache( 0, true );
+        const int mapsize = g->m.getmapsize() * SEEX;
+        std::vector<bool> result;
+        for( int x = 0; x < mapsize; x++ ) {
+            for( int y = 0; y < mapsize; y++ ) {
+                result.push_back( g->m.is_outside( tripoint( x, y, 0 ) ) );
+                result.push_back( g->m.has_floor( tripoint( x, y, 0 ) ) );
+            }
+        }
+        return result;
+    };
+    const std::vector<bool> serial = build( 1 );
+    CHECK( build( 4 ) == serial );
+    CHECK_FALSE( g->m.is_outside( tripoint( 6, 8, 0 ) ) );
+    CHECK( g->m.is_outside( tripoint( 7, 9, 0 ) ) );
+
+    clear_map();
+}
+
+static long time_map_cache_builds( const int thread_count, const int builds )
+{
+    const worker_threads_scope threads( thread_count );
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < builds; i++ ) {
+        g->m.set_transparency_cache_dirty( 0 );
+        g->m.set_outside_cache_dirty( 0 );
+        g->m.set_floor_cache_dirty( 0 );
+        g->m.build_map_cache( 0, true );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+}
+
+TEST_CASE( "build_map_cache_performance", "[.]" )
+{
+    clear_map();
+    const int builds = 500;
+    const long serial = time_map_cache_builds( 1, builds );
+    const long parallel = time_map_cache_builds( 0, builds );
+    printf( "%d map cache builds took %ld us on one thread, %ld us on %d threads\n", builds,
+            serial, parallel, parallel_thread_count() );
+}
@@ -0,0 +1,132 @@
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "player.h"
+#include "vehicle.h"
+#include "vehicle_scheduler.h"
+#include "veh_type.h"
+
+#include <chrono>
+#include <cstdio>
+
+TEST_CASE( "vehicle_scheduler_order" )
+{
+    vehicle slow;
+    vehicle fast;
+    vehicle parked;
+    vehicle falling;
+    slow.of_turn = 0.5f;
+    fast.of_turn = 1.5f;
+    parked.of_turn = 0.0f;
+    falling.of_turn = 0.0f;
+    falling.falling = true;
+
+    vehicle_scheduler sched;
+    sched.update( falling );
+    sched.update( slow );
+    sched.update( parked );
+    sched.update( fast );
+
+    SECTION( "parked vehicles are not scheduled" ) {
+        CHECK( sched.size() == 3 );
+        CHECK_FALSE( sched.has( &parked ) );
+    }
+
+    SECTION( "moving vehicles come first, fastest first, then falling ones" ) {
+        CHECK( sched.top() == &fast );
+        fast.of_turn = 0.0f;
+        sched.update( fast );
+        CHECK_FALSE( sched.has( &fast ) );
+        CHECK( sched.top() == &slow );
+        slow.of_turn = 0.0f;
+        sched.update( slow );
+        CHECK( sched.top() == &falling );
+        falling.falling = false;
+        sched.update( falling );
+        CHECK( sched.empty() );
+        CHECK( sched.top() == nullptr );
+    }
+
+    SECTION( "ties are broken by scheduling order" ) {
+        parked.of_turn = 0.5f;
+        sched.update( parked );
+        fast.of_turn = 0.5f;
+        sched.update( fast );
+        // The parked vehicle is only scheduled now, after the other two
+        CHECK( sched.top() == &slow );
+        sched.remove( &slow );
+        CHECK( sched.top() == &fast );
+        sched.remove( &fast );
+        CHECK( sched.top() == &parked );
+    }
+}
+
+TEST_CASE( "vehmove_moves_only_moving_vehicles" )
+{
+    clear_map();
+    g->u.setpos( tripoint( 0, 0, 0 ) );
+    const tripoint fast_origin( 40, 40, 0 );
+    const tripoint slow_origin( 40, 50, 0 );
+    const tripoint parked_origin( 40, 60, 0 );
+    vehicle *fast = g->m.add_vehicle( vproto_id( "bicycle" ), fast_origin, 0, 0, 0 );
+    vehicle *slow = g->m.add_vehicle( vproto_id( "bicycle" ), slow_origin, 0, 0, 0 );
+    vehicle *parked = g->m.add_vehicle( vproto_id( "bicycle" ), parked_origin, 0, 0, 0 );
+    REQUIRE( fast != nullptr );
+    REQUIRE( slow != nullptr );
+    REQUIRE( parked != nullptr );
+    fast->velocity = 4000;
+    slow->velocity = 2000;
+
+    // The first step of a new vehicle only moves its pivot, the position stays the same
+    for( int turn = 0; turn < 3; turn++ ) {
+        g->m.vehmove();
+    }
+
+    const int fast_dist = square_dist( fast_origin, fast->global_pos3() );
+    const int slow_dist = square_dist( slow_origin, slow->global_pos3() );
+    CHECK( slow_dist > 0 );
+    CHECK( fast_dist >= slow_dist );
+    CHECK( parked->global_pos3() == parked_origin );
+}
+
+// Many vehicles driving at once, with lots of parked ones around,
+// stresses vehicle selection in map::vehmove.
+TEST_CASE( "vehicle_convoy_performance", "[.]" )
+{
+    clear_map();
+    g->u.setpos( tripoint( 0, 0, 0 ) );
+
+    const int lanes = 20;
+    std::vector<vehicle *> convoy;
+    for( int lane = 0; lane < lanes; lane++ ) {
+        // A parked vehicle in every lane and a moving one next to it
+        g->m.add_vehicle( vproto_id( "bicycle" ), tripoint( 100, 10 + lane * 5, 0 ), 0, 0, 0 );
+        vehicle *veh = g->m.add_vehicle( vproto_id( "bicycle" ), tripoint( 20, 12 + lane * 5, 0 ),
+                                         0, 0, 0 );
+        REQUIRE( veh != nullptr );
+        convoy.push_back( veh );
+    }
+
+    const int turns = 200;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int turn = 0; turn < turns; turn++ ) {
+        for( vehicle *veh : convoy ) {
+            // Keep them at speed and bring them back so they never leave the bubble
+            veh->velocity = 2000;
+            veh->skidding = false;
+            tripoint pos = veh->global_pos3();
+            const int back = 20 - pos.x;
+            if( back != 0 ) {
+                veh->precalc_mounts( 1, veh->face.dir(), veh->pivot_point() );
+                g->m.displace_vehicle( pos, tripoint( back, 0, 0 ) );
+            }
+        }
+        g->m.vehmove();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const long diff = std::chrono::duration_cast<std::chrono::microseconds>( end - start ).count();
+    printf( "%d turns of %d moving vehicles took %ld us\n", turns, lanes, diff );
+}
@@ -5,6 +5,7 @@
 #include "vehicle.h"
 #include "veh_type.h"
 #include "player.h"
+#include "map_helpers.h"
 
 TEST_CASE( "destroy_grabbed_vehicle_section" )
 {
@@ -26,3 +27,61 @@ TEST_CASE( "destroy_grabbed_vehicle_section" )
         }
     }
 }
+
+static void check_flag_index( const vehicle &veh )
+{
+    for( int f = 0; f < NUM_VPFLAGS; f++ ) {
+        const vpart_bitflags flag = static_cast<vpart_bitflags>( f );
+        std::vector<int> expected;
+        for( size_t p = 0; p < veh.parts.size(); p++ ) {
+            if( !veh.parts[p].removed && veh.part_flag( p, flag ) ) {
+                expected.push_back( p );
+            }
+        }
+        CHECK( veh.all_parts_with_feature( flag, false ) == expected );
+        CHECK( veh.get_parts( flag ).size() == veh.all_parts_with_feature( flag, true ).size() );
+    }
+}
+
+TEST_CASE( "vehicle_part_flag_index" )
+{
+    clear_map();
+    for( const char *type : { "bicycle", "car", "schoolbus", "armored_car" } ) {
+        vehicle *veh_ptr = g->m.add_vehicle( vproto_id( type ), tripoint( 60, 60, 0 ), 0, 0, 0 );
+        REQUIRE( veh_ptr != nullptr );
+        vehicle &veh = *veh_ptr;
+        check_flag_index( veh );
+
+        // Removing parts has to keep the index in sync
+        veh.remove_part( veh.parts.size() - 1 );
+        check_flag_index( veh );
+        veh.part_removal_cleanup();
+        check_flag_index( veh );
+
+        g->m.destroy_vehicle( veh_ptr );
+    }
+}
+
+TEST_CASE( "vehicle_physics_cache_follows_parts" )
+{
+    clear_map();
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "car" ), tripoint( 60, 60, 0 ), 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+
+    const float area_before = veh.wheel_area( false );
+    const float k_dynamics_before = veh.k_dynamics();
+    REQUIRE( area_before > 0.0f );
+    REQUIRE( !veh.wheelcache.empty() );
+
+    WHEN( "a wheel is removed" ) {
+        veh.remove_part( veh.wheelcache.front() );
+        veh.part_removal_cleanup();
+        THEN( "the cached wheel area and friction are updated" ) {
+            CHECK( veh.wheel_area( false ) < area_before );
+            CHECK( veh.k_dynamics() > k_dynamics_before );
+        }
+    }
+
+    g->m.destroy_vehicle( veh_ptr );
+}